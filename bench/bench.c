@@ -0,0 +1,604 @@
+/*
+	KoboUSBMS: USBMS helper for KOReader
+	Copyright (C) 2020-2024 NiLuJe <ninuje@gmail.com>
+	SPDX-License-Identifier: GPL-3.0-or-later
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// Host-side microbenchmarks for the hot paths of usbms.c (i.e., what runs on every status bar tick & uevent).
+// We pull in usbms.c wholesale (with its main renamed), built with USBMS_SYSROOT pointing at a fake sysfs/procfs tree,
+// which we populate ourselves.
+// Usage: make bench (which builds & runs it), or ./Release/bench [-n iterations] [-d]
+// With -t, it instead replays a scripted session, which is what make pgo uses as its training run
+// (optionally followed by a remount of the FAT32 image passed via -f, c.f., tools/fatbench.c to generate one).
+// When built with MALLOC_STATS=1, that session also fails if the eject wait loop hits the heap.
+// With -b, it instead checks which platform backend probe_sysfs picks on a fake sysfs tree for each SoC family.
+
+#define main usbms_main
+int usbms_main(void);
+#include "../usbms.c"
+#undef main
+
+#include <getopt.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#	include <x86intrin.h>
+#	define HAS_CYCLE_COUNTER 1
+static inline uint64_t
+    read_cycles(void)
+{
+	return __rdtsc();
+}
+#else
+#	define HAS_CYCLE_COUNTER 0
+static inline uint64_t
+    read_cycles(void)
+{
+	return 0U;
+}
+#endif
+
+// Each benchmark runs BENCH_BATCHES batches of n iterations, and we report per-iteration stats across batches
+#define BENCH_BATCHES 32U
+
+typedef struct
+{
+	double   ns[BENCH_BATCHES];
+	uint64_t cycles[BENCH_BATCHES];
+} BenchStats;
+
+static int
+    cmp_double(const void* a, const void* b)
+{
+	double x = *(const double*) a;
+	double y = *(const double*) b;
+	return (x > y) - (x < y);
+}
+
+static void
+    report(const char* name, BenchStats* stats, unsigned long int n)
+{
+	uint64_t cycles = UINT64_MAX;
+	double   mean   = 0.0;
+	for (size_t i = 0U; i < BENCH_BATCHES; i++) {
+		mean += stats->ns[i];
+		if (stats->cycles[i] < cycles) {
+			cycles = stats->cycles[i];
+		}
+	}
+	mean /= BENCH_BATCHES;
+	qsort(stats->ns, BENCH_BATCHES, sizeof(*stats->ns), cmp_double);
+
+	printf("%-28s %10.1f %10.1f %10.1f %10.1f",
+	       name,
+	       stats->ns[0] / (double) n,
+	       stats->ns[BENCH_BATCHES / 2U] / (double) n,
+	       mean / (double) n,
+	       stats->ns[BENCH_BATCHES - 1U] / (double) n);
+	if (HAS_CYCLE_COUNTER) {
+		printf(" %12.0f", (double) cycles / (double) n);
+	}
+	printf("\n");
+}
+
+#define BENCH(name, n, expr)                                                                                             \
+	({                                                                                                               \
+		BenchStats stats_ = { 0 };                                                                               \
+		for (size_t b_ = 0U; b_ < BENCH_BATCHES; b_++) {                                                         \
+			struct timespec t1_ = { 0 };                                                                     \
+			struct timespec t2_ = { 0 };                                                                     \
+			clock_gettime(CLOCK_MONOTONIC, &t1_);                                                            \
+			uint64_t c1_ = read_cycles();                                                                    \
+			for (unsigned long int i_ = 0UL; i_ < (n); i_++) {                                               \
+				expr;                                                                                    \
+				__asm__ __volatile__("" ::: "memory");                                                   \
+			}                                                                                                \
+			uint64_t c2_ = read_cycles();                                                                    \
+			clock_gettime(CLOCK_MONOTONIC, &t2_);                                                            \
+			stats_.ns[b_] = (double) (t2_.tv_sec - t1_.tv_sec) * 1e9 + (double) (t2_.tv_nsec - t1_.tv_nsec); \
+			stats_.cycles[b_] = c2_ - c1_;                                                                   \
+		}                                                                                                        \
+		report(name, &stats_, n);                                                                                \
+	})
+
+static int
+    write_file(const char* path, const char* content)
+{
+	// mkdir -p the parent
+	char dir[PATH_MAX] = { 0 };
+	snprintf(dir, sizeof(dir), "%s", path);
+	for (char* p = dir + 1; *p; p++) {
+		if (*p == '/') {
+			*p = '\0';
+			if (mkdir(dir, 0755) == -1 && errno != EEXIST) {
+				fprintf(stderr, "mkdir(\"%s\"): %m\n", dir);
+				return -1;
+			}
+			*p = '/';
+		}
+	}
+
+	FILE* f = fopen(path, "we");
+	if (!f) {
+		fprintf(stderr, "fopen(\"%s\"): %m\n", path);
+		return -1;
+	}
+	fputs(content, f);
+	return fclose(f);
+}
+
+// Populate the fake sysfs/procfs tree, mimicking a Sage (sunxi, standalone USB-C controller, BD71828, PowerCover)
+static int
+    setup_sysroot(void)
+{
+	const struct
+	{
+		const char* path;
+		const char* content;
+	} files[] = {
+		{                             SUNXI_BATT_STATUS_SYSFS,   "Charging\n" },
+		{                                SUNXI_BATT_CAP_SYSFS,         "87\n" },
+		{                               ROHM_USB_ONLINE_SYSFS,          "1\n" },
+		{                               CILIX_CONNECTED_SYSFS,          "1\n" },
+		{                                CILIX_BATT_CAP_SYSFS,         "64\n" },
+		{                                  FL_INTENSITY_SYSFS,         "42\n" },
+		{                SYSFS_ROOT "/class/net/eth0/carrier",          "1\n" },
+		{ SYSFS_ROOT "/devices/virtual/input/input3/USB_PLUG",          "1\n" },
+		{                           KOBO_USB_GADGET_STATE_MTK, "configured\n" },
+	};
+	for (size_t i = 0U; i < sizeof(files) / sizeof(*files); i++) {
+		if (write_file(files[i].path, files[i].content) == -1) {
+			return -1;
+		}
+	}
+
+	// A representative /proc/modules, with the module we look for last (i.e., worst case)
+	char   modules[PIPE_BUF * 2U] = { 0 };
+	size_t len                    = 0U;
+	for (int i = 0; i < 32 && len < sizeof(modules); i++) {
+		len += (size_t) snprintf(modules + len,
+					 sizeof(modules) - len,
+					 "mod_%02d %d 0 - Live 0xbf%06x\n",
+					 i,
+					 4096 + i * 512,
+					 (unsigned int) i * 0x1000U);
+	}
+	snprintf(modules + len, sizeof(modules) - len, "g_mass_storage 41237 0 - Live 0xbf0a0000\n");
+	return write_file(PROCFS_ROOT "/modules", modules);
+}
+
+// Every attribute probe_sysfs might look for, so that each backend case starts from a clean slate
+static const char* const backend_attrs[] = {
+	NXP_BATT_CAP_SYSFS,     SUNXI_BATT_CAP_SYSFS,     MTK_BATT_CAP_SYSFS,     SUNXI_BATT_STATUS_SYSFS,
+	MTK_BATT_STATUS_SYSFS,  ROHM_USB_ONLINE_SYSFS,    NXP_CHARGER_TYPE_SYSFS, SUNXI_CHARGER_TYPE_SYSFS,
+	STD_CHARGER_TYPE_SYSFS, MTK_CHARGER_TYPE_SYSFS,
+};
+#define BACKEND_ATTRS (sizeof(backend_attrs) / sizeof(*backend_attrs))
+
+// A fake sysfs tree, and what probe_sysfs is expected to make of it
+typedef struct
+{
+	const char*     name;
+	bool            is_mtk;
+	bool            is_sunxi;
+	const char*     attrs[4];    // What exists in the tree
+	USBMS_BACKEND_E id;
+	const char*     batt_cap;
+	const char*     batt_status;
+	const char*     usb_online;
+	const char*     charger_type;
+	bool (*is_usb_plugged)(int ntxfd, bool log_status);
+} BackendCase;
+
+static const BackendCase backend_cases[] = {
+	{
+	    .name           = "mtk",
+	    .is_mtk         = true,
+	    .attrs          = { MTK_BATT_CAP_SYSFS, MTK_BATT_STATUS_SYSFS, MTK_CHARGER_TYPE_SYSFS },
+	    .id             = BACKEND_MTK,
+	    .batt_cap       = MTK_BATT_CAP_SYSFS,
+	    .batt_status    = MTK_BATT_STATUS_SYSFS,
+	    .charger_type   = MTK_CHARGER_TYPE_SYSFS,
+	    .is_usb_plugged = &sysfs_is_usb_plugged,
+	},
+	{
+	    .name           = "sunxi",
+	    .is_sunxi       = true,
+	    .attrs          = { SUNXI_BATT_CAP_SYSFS, SUNXI_BATT_STATUS_SYSFS, SUNXI_CHARGER_TYPE_SYSFS },
+	    .id             = BACKEND_SUNXI,
+	    .batt_cap       = SUNXI_BATT_CAP_SYSFS,
+	    .batt_status    = SUNXI_BATT_STATUS_SYSFS,
+	    .charger_type   = SUNXI_CHARGER_TYPE_SYSFS,
+	    .is_usb_plugged = &sysfs_is_usb_plugged,
+	},
+	{
+	    .name           = "sunxi (no charger type)",
+	    .is_sunxi       = true,
+	    .attrs          = { SUNXI_BATT_CAP_SYSFS, SUNXI_BATT_STATUS_SYSFS },
+	    .id             = BACKEND_SUNXI,
+	    .batt_cap       = SUNXI_BATT_CAP_SYSFS,
+	    .batt_status    = SUNXI_BATT_STATUS_SYSFS,
+	    .is_usb_plugged = &sysfs_is_usb_plugged,
+	},
+	{
+	    .name           = "mk9 (BD71828)",
+	    .attrs          = { SUNXI_BATT_CAP_SYSFS,
+				ROHM_USB_ONLINE_SYSFS,
+				SUNXI_BATT_STATUS_SYSFS,
+				SUNXI_CHARGER_TYPE_SYSFS },
+	    .id             = BACKEND_MK9,
+	    .batt_cap       = SUNXI_BATT_CAP_SYSFS,
+	    .batt_status    = SUNXI_BATT_STATUS_SYSFS,
+	    .usb_online     = ROHM_USB_ONLINE_SYSFS,
+	    .charger_type   = SUNXI_CHARGER_TYPE_SYSFS,
+	    .is_usb_plugged = &sysfs_is_usb_online,
+	},
+	{
+	    .name           = "mk9",
+	    .attrs          = { SUNXI_BATT_CAP_SYSFS, SUNXI_BATT_STATUS_SYSFS, STD_CHARGER_TYPE_SYSFS },
+	    .id             = BACKEND_MK9,
+	    .batt_cap       = SUNXI_BATT_CAP_SYSFS,
+	    .batt_status    = SUNXI_BATT_STATUS_SYSFS,
+	    .charger_type   = STD_CHARGER_TYPE_SYSFS,
+	    .is_usb_plugged = &sysfs_is_usb_plugged,
+	},
+	{
+	    .name           = "nxp",
+	    .attrs          = { NXP_BATT_CAP_SYSFS, NXP_CHARGER_TYPE_SYSFS },
+	    .id             = BACKEND_NXP,
+	    .batt_cap       = NXP_BATT_CAP_SYSFS,
+	    .charger_type   = NXP_CHARGER_TYPE_SYSFS,
+	    .is_usb_plugged = &ioctl_is_usb_plugged,
+	},
+};
+#define BACKEND_CASES (sizeof(backend_cases) / sizeof(*backend_cases))
+
+static bool
+    check_path(const char* tc, const char* what, const char* got, const char* expected)
+{
+	if ((!got && !expected) || (got && expected && strcmp(got, expected) == 0)) {
+		return true;
+	}
+	fprintf(stderr,
+		"[%s] %s: got `%s`, expected `%s`\n",
+		tc,
+		what,
+		got ? got : "(none)",
+		expected ? expected : "(none)");
+	return false;
+}
+
+// Check that the cable-sense callback follows what its attribute says
+// NOTE: The ioctl needs an actual NTX board, so we can only check that it was picked.
+static bool
+    check_cable_sense(const BackendCase* tc)
+{
+	const char* path      = NULL;
+	const char* plugged   = NULL;
+	const char* unplugged = NULL;
+	if (tc->is_usb_plugged == &sysfs_is_usb_online) {
+		path      = tc->usb_online;
+		plugged   = "1\n";
+		unplugged = "0\n";
+	} else if (tc->is_usb_plugged == &sysfs_is_usb_plugged) {
+		path      = tc->batt_status;
+		plugged   = "Charging\n";
+		unplugged = "Discharging\n";
+	} else {
+		return true;
+	}
+
+	bool ok = true;
+	if (write_file(path, plugged) == -1 || !(*usbms_backend.is_usb_plugged)(-1, false)) {
+		fprintf(stderr, "[%s] Cable sensing missed a plug in\n", tc->name);
+		ok = false;
+	}
+	if (write_file(path, unplugged) == -1 || (*usbms_backend.is_usb_plugged)(-1, false)) {
+		fprintf(stderr, "[%s] Cable sensing missed an unplug\n", tc->name);
+		ok = false;
+	}
+	return ok;
+}
+
+// Run probe_sysfs against a fake sysfs tree for each backend, and check what it picked
+static int
+    test_backends(void)
+{
+	size_t failures = 0U;
+	for (const BackendCase* tc = backend_cases; tc < backend_cases + BACKEND_CASES; tc++) {
+		for (size_t i = 0U; i < BACKEND_ATTRS; i++) {
+			unlink(backend_attrs[i]);
+		}
+		for (size_t i = 0U; i < sizeof(tc->attrs) / sizeof(*tc->attrs) && tc->attrs[i]; i++) {
+			if (write_file(tc->attrs[i], "\n") == -1) {
+				return -1;
+			}
+		}
+
+		FBInkState       fbink_state = { .is_mtk = tc->is_mtk, .is_sunxi = tc->is_sunxi };
+		const USBMSProbe probe       = { .fbink_state = &fbink_state, .ntxfd = -1 };
+		probe_sysfs(&probe);
+		close_sysfs_attrs();
+		setup_sysfs_attrs();
+
+		bool ok = true;
+		if (usbms_backend.id != tc->id) {
+			fprintf(stderr,
+				"[%s] Picked the %s backend, expected %s\n",
+				tc->name,
+				usbms_backend.name,
+				usbms_backends[tc->id].name);
+			ok = false;
+		}
+		ok &= check_path(tc->name, "batt_cap", usbms_backend.batt_cap, tc->batt_cap);
+		ok &= check_path(tc->name, "batt_status", usbms_backend.batt_status, tc->batt_status);
+		ok &= check_path(tc->name, "usb_online", usbms_backend.usb_online, tc->usb_online);
+		ok &= check_path(tc->name, "charger_type", usbms_backend.charger_type, tc->charger_type);
+		if (usbms_backend.is_usb_plugged != tc->is_usb_plugged) {
+			fprintf(stderr, "[%s] Picked the wrong cable-sense callback\n", tc->name);
+			ok = false;
+		} else {
+			ok &= check_cable_sense(tc);
+		}
+		close_sysfs_attrs();
+
+		printf("%-28s %s\n", tc->name, ok ? "ok" : "FAILED");
+		failures += !ok;
+	}
+
+	// Don't leave any of that behind for the benchmarks
+	for (size_t i = 0U; i < BACKEND_ATTRS; i++) {
+		unlink(backend_attrs[i]);
+	}
+	return failures ? -1 : 0;
+}
+
+// A raw kernel uevent, as read from the netlink socket
+typedef struct
+{
+	const char* msg;
+	size_t      len;
+} BenchUevent;
+#define BENCH_UEVENT(msg) { msg, sizeof(msg) - 1U }
+
+// Go through the same parsing & matching as our event loops
+static USB_EVENT_E
+    replay_uevent(struct uevent* uev, const BenchUevent* event)
+{
+	ue_reset_event(uev);
+	memcpy(uev->buf, event->msg, event->len);
+	uev->buf[event->len] = '\0';
+	if (ue_parse_event_msg(uev, event->len) != EXIT_SUCCESS) {
+		return USB_EVENT_NONE;
+	}
+	return classify_uevent(uev);
+}
+
+// What print_status does, minus the actual drawing
+static bool
+    refresh_status(USBMSContext* ctx)
+{
+	USBMSStatus status = { 0 };
+	get_status(ctx, &status);
+	bool changed = diff_status(&ctx->status, &status) != 0;
+	ctx->status  = status;
+	return changed;
+}
+
+// Scripted session for the PGO training run (c.f., make pgo), in the order main goes through it:
+// plug in, countdown, session, eject & remount.
+// Screen updates & the actual (un)mounting are left out, as neither can happen on the build host.
+static int
+    train_session(USBMSContext* ctx, const char* image, unsigned long int ticks)
+{
+	static const BenchUevent charge_tick = BENCH_UEVENT("change@/devices/platform/battery\0"
+							    "ACTION=change\0"
+							    "DEVPATH=/devices/platform/battery\0"
+							    "SUBSYSTEM=power_supply\0"
+							    "POWER_SUPPLY_NAME=battery\0"
+							    "SEQNUM=1338\0");
+	static const BenchUevent noise       = BENCH_UEVENT("add@/devices/virtual/bdi/179:8\0"
+							    "ACTION=add\0"
+							    "DEVPATH=/devices/virtual/bdi/179:8\0"
+							    "SUBSYSTEM=bdi\0"
+							    "SEQNUM=1339\0");
+	static const BenchUevent plug        = BENCH_UEVENT("add@/devices/platform/usb_host\0"
+							    "ACTION=add\0"
+							    "DEVPATH=/devices/platform/usb_host\0"
+							    "SUBSYSTEM=platform\0"
+							    "MODALIAS=platform:usb_host\0"
+							    "SEQNUM=1340\0");
+	static const BenchUevent eject       = BENCH_UEVENT("offline@/devices/platform/soc/5100000.udc-controller\0"
+							    "ACTION=offline\0"
+							    "DEVPATH=/devices/platform/soc/5100000.udc-controller\0"
+							    "SUBSYSTEM=platform\0"
+							    "SEQNUM=1341\0");
+	struct uevent            uev         = { 0 };
+	unsigned long int        redraws     = 0UL;
+
+	// Waiting for a plug in: status bar ticks, with the odd unrelated uevent
+	for (unsigned long int i = 0UL; i < ticks; i++) {
+		redraws += refresh_status(ctx);
+		replay_uevent(&uev, i % 4UL ? &charge_tick : &noise);
+		(*usbms_backend.is_usb_plugged)(ctx->ntxfd, false);
+		is_usbc_plugged(false);
+	}
+	if (replay_uevent(&uev, &plug) != USB_EVENT_PLUG_HOST) {
+		fprintf(stderr, "Plug in event wasn't recognized!\n");
+		return -1;
+	}
+	(*usbms_backend.is_usb_plugged)(ctx->ntxfd, true);
+	get_frontlight_intensity();
+
+	// Session setup
+	is_module_loaded("g_file_storage ");
+	is_module_loaded("g_mass_storage ");
+
+	// The session itself: charge ticks (with the battery actually charging), and UDC state changes, until the eject
+	char gadget_state[16] = { 0 };
+	char capacity[8]      = { 0 };
+	trace_begin(PHASE_HOST_SESSION);
+	for (unsigned long int i = 0UL; i < ticks; i++) {
+		if (i % 16UL == 0UL) {
+			snprintf(capacity, sizeof(capacity), "%lu\n", 50UL + (i / 16UL) % 51UL);
+			write_file(SUNXI_BATT_CAP_SYSFS, capacity);
+		}
+		if (replay_uevent(&uev, &charge_tick) == USB_EVENT_CHARGE_TICK) {
+			redraws += refresh_status(ctx);
+		}
+		if (i % 8UL == 0UL) {
+			read_sysfs_attr(ATTR_UDC_STATE, gadget_state, sizeof(gadget_state));
+			redraws += refresh_status(ctx);
+		}
+	}
+	if (replay_uevent(&uev, &eject) != USB_EVENT_EJECT) {
+		fprintf(stderr, "Eject event wasn't recognized!\n");
+		return -1;
+	}
+	trace_end(PHASE_HOST_SESSION);
+#ifdef USBMS_MALLOC_STATS
+	// The eject wait loop is expected to stay off the heap entirely (drawing aside, which we don't do here)
+	if (alloc_stats[PHASE_HOST_SESSION].allocs != 0UL) {
+		fprintf(stderr,
+			"The host session went through %lu heap allocations!\n",
+			alloc_stats[PHASE_HOST_SESSION].allocs);
+		return -1;
+	}
+	printf("No heap allocations during the host session\n");
+#endif
+
+	// Teardown & remount
+	is_module_loaded("g_mass_storage ");
+	if (image) {
+		FATCheckReport report = { 0 };
+		if (check_partition(image) == -1 || fat_check_volume(image, &report) != EXIT_SUCCESS ||
+		    !refresh_fsinfo(image)) {
+			fprintf(stderr, "Could not check `%s`!\n", image);
+			return -1;
+		}
+	}
+	redraws += refresh_status(ctx);
+
+	printf("Trained on a %lu ticks session (%lu status bar redraws)%s\n", ticks, redraws, image ? ", with a remount" : "");
+	return 0;
+}
+
+int
+    main(int argc, char* argv[])
+{
+	unsigned long int n       = 2000UL;
+	bool              verbose = false;
+	bool              train   = false;
+	bool              probe   = false;
+	const char*       image   = NULL;
+	int               opt;
+	while ((opt = getopt(argc, argv, "n:dtf:bh")) != -1) {
+		switch (opt) {
+			case 'n':
+				n = strtoul(optarg, NULL, 10);
+				if (n == 0UL) {
+					n = 1UL;
+				}
+				break;
+			case 'd':
+				verbose = true;
+				break;
+			case 't':
+				train = true;
+				break;
+			case 'f':
+				image = optarg;
+				break;
+			case 'b':
+				probe = true;
+				break;
+			default:
+				fprintf(stderr, "Usage: %s [-n iterations] [-d] [-t [-f fat32.img]] [-b]\n", argv[0]);
+				return opt == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+	}
+
+	// Debug logging is compiled in on every path we measure, and would otherwise dominate with syslogd in the loop.
+	// Use -d to measure it anyway.
+	openlog("usbms-bench", LOG_NDELAY, LOG_DAEMON);
+	if (!verbose) {
+		setlogmask(LOG_UPTO(LOG_INFO));
+	}
+
+	trace_init();
+	if (setup_sysroot() == -1) {
+		return EXIT_FAILURE;
+	}
+	if (probe) {
+		int rc = test_backends();
+		closelog();
+		return rc == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+	usbms_backend                = usbms_backends[BACKEND_SUNXI];
+	usbms_backend.usb_online     = ROHM_USB_ONLINE_SYSFS;
+	usbms_backend.is_usb_plugged = &sysfs_is_usb_online;
+	USBC_PLUG_SYSFS              = arena_printf("%s", SYSFS_ROOT "/devices/virtual/input/input3/USB_PLUG");
+	setenv("INTERFACE", "eth0", 1);
+	setup_sysfs_attrs();
+
+	USBMSContext ctx          = { 0 };
+	ctx.ntxfd                 = -1;
+	ctx.fbink_state.device_id = DEVICE_KOBO_SAGE;
+	USBMSStatus   status      = { 0 };
+	uint8_t       hhu         = 0U;
+	volatile bool sink        = false;
+
+	// A typical plug event, as sent by the kernel
+	static const char uevent_msg[] = "change@/devices/platform/usb_host\0"
+					 "ACTION=change\0"
+					 "DEVPATH=/devices/platform/usb_host\0"
+					 "SUBSYSTEM=platform\0"
+					 "MODALIAS=platform:usb_host\0"
+					 "SEQNUM=1337\0";
+	struct uevent uev = { 0 };
+	memcpy(uev.buf, uevent_msg, sizeof(uevent_msg));
+
+	if (train) {
+		int rc = train_session(&ctx, image, n);
+		close_sysfs_attrs();
+		closelog();
+		return rc == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	printf("Sysroot: %s, %lu iterations x %u batches (ns/op, then cycles/op for the best batch)\n",
+	       USBMS_SYSROOT,
+	       n,
+	       BENCH_BATCHES);
+	printf("%-28s %10s %10s %10s %10s%s\n", "", "min", "median", "mean", "max", HAS_CYCLE_COUNTER ? "       cycles" : "");
+
+	BENCH("get_status", n, get_status(&ctx, &status));
+	BENCH("sysfs_is_usb_plugged", n, sink = sysfs_is_usb_plugged(-1, false));
+	BENCH("sysfs_is_usb_online", n, sink = sysfs_is_usb_online(-1, false));
+	BENCH("is_usbc_plugged", n, sink = is_usbc_plugged(false) == 1);
+	BENCH("get_frontlight_intensity", n, sink = get_frontlight_intensity() != 0U);
+	BENCH("is_module_loaded (hit)", n, sink = is_module_loaded("g_mass_storage "));
+	BENCH("is_module_loaded (miss)", n, sink = is_module_loaded("g_file_storage "));
+	BENCH("strtoul_hhu", n * 100UL, sink = strtoul_hhu("87", &hhu) == EXIT_SUCCESS);
+	BENCH("ue_parse_event_msg", n * 100UL, {
+		ue_reset_event(&uev);
+		sink = ue_parse_event_msg(&uev, sizeof(uevent_msg) - 1U) == EXIT_SUCCESS;
+	});
+	BENCH("classify_uevent", n * 100UL, sink = classify_uevent(&uev) == USB_EVENT_PLUG_HOST);
+	(void) sink;
+
+	close_sysfs_attrs();
+	closelog();
+	return EXIT_SUCCESS;
+}
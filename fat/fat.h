@@ -0,0 +1,787 @@
+/*
+	KoboUSBMS: USBMS helper for KOReader
+	Copyright (C) 2020-2024 NiLuJe <ninuje@gmail.com>
+	SPDX-License-Identifier: GPL-3.0-or-later
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// Minimal, header-only FAT32 helpers, so we can avoid spawning dosfsck when it's not needed.
+// c.f., Microsoft's FAT32 File System Specification (fatgen103) & fs/fat in the Linux kernel.
+
+#ifndef __FAT_H
+#define __FAT_H
+
+// For the LFS API (we need 64-bit offsets on 32-bit ARM)
+#ifndef _GNU_SOURCE
+#	define _GNU_SOURCE
+#endif
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <syslog.h>
+#include <unistd.h>
+
+// We read the FAT in place, and we only ever run on little-endian hardware
+#if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#	error "fat.h assumes a little-endian host"
+#endif
+
+// We log to syslog
+#define FAT_LOG(prio, fmt, ...) ({ syslog(prio, fmt, ##__VA_ARGS__); })
+
+// Same, but with __PRETTY_FUNCTION__:__LINE__ right before fmt
+#define FAT_PFLOG(prio, fmt, ...) ({ FAT_LOG(prio, "[%s:%d] " fmt, __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__); })
+
+// Boot sector layout (offsets in bytes)
+#define FAT_BS_BYTES_PER_SEC  0x0B
+#define FAT_BS_SEC_PER_CLUS   0x0D
+#define FAT_BS_RSVD_SEC_CNT   0x0E
+#define FAT_BS_NUM_FATS       0x10
+#define FAT_BS_ROOT_ENT_CNT   0x11
+#define FAT_BS_TOT_SEC16      0x13
+#define FAT_BS_FAT_SZ16       0x16
+#define FAT_BS_TOT_SEC32      0x20
+#define FAT_BS_FAT_SZ32       0x24
+#define FAT_BS_EXT_FLAGS      0x28
+#define FAT_BS_ROOT_CLUS      0x2C
+#define FAT_BS_FS_INFO        0x30
+// Windows calls this BS_Reserved1, Linux uses it to flag a mounted (i.e., dirty) volume (c.f., FAT_STATE_DIRTY)
+#define FAT_BS_STATE          0x41
+#define FAT_BS_SIGNATURE      0x1FE
+#define FAT_BS_SIZE           512U
+#define FAT_STATE_DIRTY       0x01
+
+// FAT[1] flags (FAT32)
+#define FAT32_CLN_SHUT_BIT    0x08000000U    // Set when the volume was cleanly unmounted
+#define FAT32_HRD_ERR_BIT     0x04000000U    // Set when no disk I/O errors were encountered
+#define FAT32_ENTRY_MASK      0x0FFFFFFFU
+#define FAT32_BAD_CLUSTER     0x0FFFFFF7U
+#define FAT32_EOC_MIN         0x0FFFFFF8U
+
+// BPB_ExtFlags (FAT32)
+#define FAT32_EXT_NO_MIRROR   0x0080U    // Set when only the active FAT is kept up to date
+#define FAT32_EXT_ACTIVE_MASK 0x000FU    // Zero-based index of the active FAT (only meaningful w/ FAT32_EXT_NO_MIRROR)
+
+// FSInfo sector
+#define FAT_FSI_LEAD_SIG      0x000
+#define FAT_FSI_STRUC_SIG     0x1E4
+#define FAT_FSI_FREE_COUNT    0x1E8
+#define FAT_FSI_NXT_FREE      0x1EC
+#define FAT_FSI_TRAIL_SIG     0x1FC
+#define FAT_FSI_LEAD_MAGIC    0x41615252U
+#define FAT_FSI_STRUC_MAGIC   0x61417272U
+#define FAT_FSI_TRAIL_MAGIC   0xAA550000U
+#define FAT_FSI_UNKNOWN       0xFFFFFFFFU
+
+// Directory entries
+#define FAT_DIRENT_SIZE       32U
+#define FAT_DIRENT_END        0x00
+#define FAT_DIRENT_DELETED    0xE5
+#define FAT_ATTR_VOLUME_ID    0x08
+#define FAT_ATTR_DIRECTORY    0x10
+#define FAT_ATTR_LFN          0x0F
+
+typedef enum
+{
+	FAT_STATUS_CLEAN = 0,
+	FAT_STATUS_DIRTY,
+	// Not FAT32, or we couldn't make sense of it: let dosfsck deal with it
+	FAT_STATUS_UNKNOWN,
+} FAT_STATUS_E;
+
+// What we need from the BPB
+typedef struct
+{
+	uint32_t bytes_per_sector;
+	uint32_t sectors_per_cluster;
+	uint32_t reserved_sectors;
+	uint32_t num_fats;
+	uint32_t fat_sectors;
+	uint32_t total_sectors;
+	uint32_t root_cluster;
+	uint32_t fsinfo_sector;
+	uint16_t ext_flags;
+	uint8_t  state;
+} FATVolume;
+
+static inline uint16_t
+    fat_le16(const unsigned char* p)
+{
+	return (uint16_t) (p[0] | (p[1] << 8U));
+}
+
+static inline uint32_t
+    fat_le32(const unsigned char* p)
+{
+	return (uint32_t) p[0] | ((uint32_t) p[1] << 8U) | ((uint32_t) p[2] << 16U) | ((uint32_t) p[3] << 24U);
+}
+
+// Parse & sanity check a FAT32 boot sector
+__attribute__((unused)) static int
+    fat_parse_boot_sector(const unsigned char* bs, FATVolume* vol)
+{
+	if (fat_le16(bs + FAT_BS_SIGNATURE) != 0xAA55U) {
+		return -EINVAL;
+	}
+
+	vol->bytes_per_sector    = fat_le16(bs + FAT_BS_BYTES_PER_SEC);
+	vol->sectors_per_cluster = bs[FAT_BS_SEC_PER_CLUS];
+	vol->reserved_sectors    = fat_le16(bs + FAT_BS_RSVD_SEC_CNT);
+	vol->num_fats            = bs[FAT_BS_NUM_FATS];
+	vol->fat_sectors         = fat_le32(bs + FAT_BS_FAT_SZ32);
+	vol->total_sectors       = fat_le16(bs + FAT_BS_TOT_SEC16);
+	if (vol->total_sectors == 0U) {
+		vol->total_sectors = fat_le32(bs + FAT_BS_TOT_SEC32);
+	}
+	vol->root_cluster  = fat_le32(bs + FAT_BS_ROOT_CLUS);
+	vol->fsinfo_sector = fat_le16(bs + FAT_BS_FS_INFO);
+	vol->ext_flags     = fat_le16(bs + FAT_BS_EXT_FLAGS);
+	vol->state         = bs[FAT_BS_STATE];
+
+	// Power of two between 512 & 4096
+	if (vol->bytes_per_sector < 512U || vol->bytes_per_sector > 4096U ||
+	    (vol->bytes_per_sector & (vol->bytes_per_sector - 1U)) != 0U) {
+		return -EINVAL;
+	}
+	// Power of two
+	if (vol->sectors_per_cluster == 0U || (vol->sectors_per_cluster & (vol->sectors_per_cluster - 1U)) != 0U) {
+		return -EINVAL;
+	}
+	if (vol->reserved_sectors == 0U || vol->num_fats == 0U || vol->total_sectors == 0U) {
+		return -EINVAL;
+	}
+	if ((vol->ext_flags & FAT32_EXT_NO_MIRROR) && (vol->ext_flags & FAT32_EXT_ACTIVE_MASK) >= vol->num_fats) {
+		return -EINVAL;
+	}
+	// FAT32 has no fixed root directory, and no 16-bit FAT size
+	if (fat_le16(bs + FAT_BS_ROOT_ENT_CNT) != 0U || fat_le16(bs + FAT_BS_FAT_SZ16) != 0U || vol->fat_sectors == 0U) {
+		return -ENOTSUP;
+	}
+
+	return EXIT_SUCCESS;
+}
+
+// Check the "volume dirty" flags of a FAT32 partition, without walking the filesystem.
+// Sets *bytes_read to the amount of data we actually had to read from the device.
+__attribute__((unused)) static FAT_STATUS_E
+    fat_check_dirty(const char* device, size_t* bytes_read)
+{
+	*bytes_read = 0U;
+
+	int fd = open(device, O_RDONLY | O_CLOEXEC | O_LARGEFILE);
+	if (fd == -1) {
+		FAT_PFLOG(LOG_WARNING, "open(\"%s\"): %m", device);
+		return FAT_STATUS_UNKNOWN;
+	}
+
+	FAT_STATUS_E  status                 = FAT_STATUS_UNKNOWN;
+	unsigned char bs[FAT_BS_SIZE]        = { 0 };
+	unsigned char fat1[sizeof(uint32_t)] = { 0 };
+	FATVolume     vol                    = { 0 };
+	ssize_t       len                    = pread(fd, bs, sizeof(bs), 0);
+	if (len != (ssize_t) sizeof(bs)) {
+		FAT_PFLOG(LOG_WARNING, "Short read on the boot sector of %s", device);
+		goto cleanup;
+	}
+	*bytes_read += (size_t) len;
+
+	int rc = fat_parse_boot_sector(bs, &vol);
+	if (rc != EXIT_SUCCESS) {
+		FAT_LOG(LOG_NOTICE, "%s doesn't look like a FAT32 volume (%s)", device, strerror(-rc));
+		goto cleanup;
+	}
+
+	// FAT[1] lives right after FAT[0], at the start of the first FAT
+	off_t fat1_offset = (off_t) vol.reserved_sectors * vol.bytes_per_sector + (off_t) sizeof(uint32_t);
+	len               = pread(fd, fat1, sizeof(fat1), fat1_offset);
+	if (len != (ssize_t) sizeof(fat1)) {
+		FAT_PFLOG(LOG_WARNING, "Short read on FAT[1] of %s", device);
+		goto cleanup;
+	}
+	*bytes_read += (size_t) len;
+
+	uint32_t entry = fat_le32(fat1);
+	if (vol.state & FAT_STATE_DIRTY) {
+		FAT_LOG(LOG_NOTICE, "%s was not cleanly unmounted (boot sector state: %#x)", device, vol.state);
+		status = FAT_STATUS_DIRTY;
+	} else if (!(entry & FAT32_CLN_SHUT_BIT)) {
+		FAT_LOG(LOG_NOTICE, "%s was not cleanly unmounted (FAT[1]: %#x)", device, entry);
+		status = FAT_STATUS_DIRTY;
+	} else if (!(entry & FAT32_HRD_ERR_BIT)) {
+		FAT_LOG(LOG_NOTICE, "%s encountered disk I/O errors (FAT[1]: %#x)", device, entry);
+		status = FAT_STATUS_DIRTY;
+	} else {
+		status = FAT_STATUS_CLEAN;
+	}
+
+cleanup:
+	close(fd);
+	return status;
+}
+
+// The FAT region of a volume, mapped in place
+typedef struct
+{
+	unsigned char*  map;
+	size_t          map_size;
+	const uint32_t* fat;             // Active FAT copy (i.e., the first one, unless mirroring is disabled)
+	uint64_t        fat_size;        // Size of a single FAT copy, in bytes
+	uint32_t        clusters;        // Amount of data clusters
+	uint32_t        max_cluster;     // Highest valid cluster number
+	uint32_t        cluster_size;    // In bytes
+	uint64_t        data_offset;     // Offset of the data area, in bytes
+} FATMapping;
+
+// Compute a volume's geometry, and map every FAT copy in one go (read-only)
+__attribute__((unused)) static int
+    fat_map(int fd, const FATVolume* vol, FATMapping* m)
+{
+	m->map = MAP_FAILED;
+
+	uint64_t fat_start = (uint64_t) vol->reserved_sectors * vol->bytes_per_sector;
+	uint64_t data_sec  = vol->reserved_sectors + (uint64_t) vol->num_fats * vol->fat_sectors;
+	if (data_sec >= vol->total_sectors) {
+		return -EINVAL;
+	}
+	m->fat_size     = (uint64_t) vol->fat_sectors * vol->bytes_per_sector;
+	m->cluster_size = vol->bytes_per_sector * vol->sectors_per_cluster;
+	m->data_offset  = data_sec * vol->bytes_per_sector;
+	m->clusters     = (uint32_t) ((vol->total_sectors - data_sec) / vol->sectors_per_cluster);
+	m->max_cluster  = m->clusters + 1U;
+	// The FAT has to be large enough to describe every cluster
+	if (m->max_cluster > FAT32_BAD_CLUSTER - 1U || ((uint64_t) m->max_cluster + 1U) * 4U > m->fat_size ||
+	    vol->root_cluster < 2U || vol->root_cluster > m->max_cluster) {
+		return -EINVAL;
+	}
+
+	// mmap wants a page-aligned offset
+	uint64_t page  = (uint64_t) sysconf(_SC_PAGESIZE);
+	uint64_t delta = fat_start % page;
+	m->map_size    = (size_t) (delta + m->fat_size * vol->num_fats);
+	m->map         = mmap64(NULL, m->map_size, PROT_READ, MAP_SHARED, fd, (off64_t) (fat_start - delta));
+	if (m->map == MAP_FAILED) {
+		int rc = -errno;
+		FAT_PFLOG(LOG_WARNING, "mmap: %m");
+		return rc;
+	}
+	// We'll be going through it sequentially, at least at first
+	madvise(m->map, m->map_size, MADV_SEQUENTIAL);
+	// NOTE: The FAT is sector-aligned, and the mapping page-aligned, so this is suitably aligned.
+	uint32_t active = (vol->ext_flags & FAT32_EXT_NO_MIRROR) ? (vol->ext_flags & FAT32_EXT_ACTIVE_MASK) : 0U;
+	m->fat          = (const uint32_t*) (const void*) (m->map + delta + m->fat_size * active);
+
+	return EXIT_SUCCESS;
+}
+
+__attribute__((unused)) static void
+    fat_unmap(FATMapping* m)
+{
+	if (m->map != MAP_FAILED) {
+		munmap(m->map, m->map_size);
+		m->map = MAP_FAILED;
+	}
+}
+
+// What fat_check_volume found.
+// Anything but the free cluster count is an inconsistency dosfsck -a knows how to repair.
+typedef struct
+{
+	uint32_t clusters;           // Amount of data clusters on the volume
+	uint32_t free_clusters;      // Amount of free clusters according to the FAT
+	uint32_t bad_links;          // FAT entries pointing outside of the data area (or at a bad cluster)
+	uint32_t free_links;         // Chains running into a free cluster
+	uint32_t cross_links;        // Clusters claimed more than once (or looping chains)
+	uint32_t size_mismatches;    // Files whose chain length doesn't match their size
+	uint32_t bad_dirents;        // Directory entries pointing nowhere
+	uint32_t lost_clusters;      // Allocated clusters that aren't reachable from the directory tree
+	uint32_t fat_mismatches;     // FAT copies that differ from the first one
+} FATCheckReport;
+
+// Internal state of the checker
+typedef struct
+{
+	int             fd;
+	FATVolume       vol;
+	FATMapping      m;
+	uint32_t        max_cluster;
+	uint32_t        cluster_size;
+	const uint32_t* fat;
+	unsigned char*  owned;    // Packed bitmap of clusters claimed by the directory tree
+	unsigned char*  buf;      // One cluster's worth of directory entries
+	uint32_t*       dirs;     // Stack of directories left to walk
+	size_t          dirs_count;
+	size_t          dirs_size;
+	FATCheckReport* report;
+} FATChecker;
+
+static inline bool
+    fat_bitmap_test_and_set(unsigned char* bitmap, uint32_t bit)
+{
+	unsigned char mask = (unsigned char) (1U << (bit & 7U));
+	bool          was  = !!(bitmap[bit >> 3U] & mask);
+	bitmap[bit >> 3U] |= mask;
+	return was;
+}
+
+static inline bool
+    fat_bitmap_test(const unsigned char* bitmap, uint32_t bit)
+{
+	return !!(bitmap[bit >> 3U] & (1U << (bit & 7U)));
+}
+
+// Vectorized (via GCC's generic vector extensions, so, NEON on ARM, SSE on x86) pass over the FAT,
+// counting free clusters & out of range links in one go.
+// Returns the amount of out of range links, and stores the free cluster count in *free_clusters,
+// as well as the first free cluster (or 0 if there are none) in *first_free, if it's not NULL.
+typedef uint32_t fat_v4u32 __attribute__((vector_size(16)));
+__attribute__((unused)) static uint32_t
+    fat_scan_entries(const uint32_t* fat, uint32_t max_cluster, uint32_t* free_clusters, uint32_t* first_free)
+{
+	const fat_v4u32 mask    = { FAT32_ENTRY_MASK, FAT32_ENTRY_MASK, FAT32_ENTRY_MASK, FAT32_ENTRY_MASK };
+	const fat_v4u32 one     = { 1U, 1U, 1U, 1U };
+	const fat_v4u32 max     = { max_cluster, max_cluster, max_cluster, max_cluster };
+	const fat_v4u32 bad     = { FAT32_BAD_CLUSTER, FAT32_BAD_CLUSTER, FAT32_BAD_CLUSTER, FAT32_BAD_CLUSTER };
+	fat_v4u32       nfree   = { 0U };
+	fat_v4u32       nbroken = { 0U };
+	uint32_t        first   = 0U;
+
+	// Data clusters start at 2, handle the first two entries of the first block manually
+	uint32_t c = 2U;
+	for (; c < 4U && c <= max_cluster; c++) {
+		uint32_t e = fat[c] & FAT32_ENTRY_MASK;
+		if (e == 0U) {
+			nfree[0]++;
+			if (!first) {
+				first = c;
+			}
+		} else if (e == 1U || (e > max_cluster && e < FAT32_BAD_CLUSTER)) {
+			nbroken[0]++;
+		}
+	}
+	for (; c + 4U <= max_cluster + 1U; c += 4U) {
+		fat_v4u32 v;
+		memcpy(&v, fat + c, sizeof(v));
+		v = v & mask;
+		// Comparisons yield all-ones (i.e., -1) in matching lanes
+		fat_v4u32 is_free   = (fat_v4u32) (v == 0U);
+		fat_v4u32 is_broken = (fat_v4u32) ((v == one) | ((v > max) & (v < bad)));
+		nfree -= is_free;
+		nbroken -= is_broken;
+		if (!first && (is_free[0] | is_free[1] | is_free[2] | is_free[3])) {
+			for (uint32_t i = 0U; i < 4U; i++) {
+				if (is_free[i]) {
+					first = c + i;
+					break;
+				}
+			}
+		}
+	}
+	// Leftovers
+	for (; c <= max_cluster; c++) {
+		uint32_t e = fat[c] & FAT32_ENTRY_MASK;
+		if (e == 0U) {
+			nfree[0]++;
+			if (!first) {
+				first = c;
+			}
+		} else if (e == 1U || (e > max_cluster && e < FAT32_BAD_CLUSTER)) {
+			nbroken[0]++;
+		}
+	}
+
+	*free_clusters = nfree[0] + nfree[1] + nfree[2] + nfree[3];
+	if (first_free) {
+		*first_free = first;
+	}
+	return nbroken[0] + nbroken[1] + nbroken[2] + nbroken[3];
+}
+
+// Walk a cluster chain, claiming every cluster along the way. Returns the length of the chain.
+static uint32_t
+    fat_walk_chain(FATChecker* chk, uint32_t cluster)
+{
+	uint32_t count = 0U;
+	while (true) {
+		if (cluster < 2U || cluster > chk->max_cluster) {
+			chk->report->bad_links++;
+			break;
+		}
+		// Already claimed, either by another file, or earlier in this chain (i.e., a loop)
+		if (fat_bitmap_test_and_set(chk->owned, cluster)) {
+			chk->report->cross_links++;
+			break;
+		}
+		count++;
+
+		uint32_t next = chk->fat[cluster] & FAT32_ENTRY_MASK;
+		if (next >= FAT32_EOC_MIN) {
+			break;
+		} else if (next == 0U) {
+			chk->report->free_links++;
+			break;
+		} else if (next == FAT32_BAD_CLUSTER) {
+			chk->report->bad_links++;
+			break;
+		}
+		cluster = next;
+	}
+	return count;
+}
+
+static int
+    fat_push_dir(FATChecker* chk, uint32_t cluster)
+{
+	if (chk->dirs_count == chk->dirs_size) {
+		size_t    size = chk->dirs_size ? chk->dirs_size * 2U : 64U;
+		uint32_t* dirs = realloc(chk->dirs, size * sizeof(*dirs));
+		if (!dirs) {
+			FAT_PFLOG(LOG_ERR, "realloc: %m");
+			return -ENOMEM;
+		}
+		chk->dirs      = dirs;
+		chk->dirs_size = size;
+	}
+	chk->dirs[chk->dirs_count++] = cluster;
+	return EXIT_SUCCESS;
+}
+
+// Parse one cluster's worth of directory entries. Returns 1 if we hit the end of the directory's entries.
+static int
+    fat_check_dirents(FATChecker* chk)
+{
+	for (uint32_t off = 0U; off < chk->cluster_size; off += FAT_DIRENT_SIZE) {
+		const unsigned char* de = chk->buf + off;
+		if (de[0] == FAT_DIRENT_END) {
+			return 1;
+		}
+		if (de[0] == FAT_DIRENT_DELETED || de[11] == FAT_ATTR_LFN || (de[11] & FAT_ATTR_VOLUME_ID)) {
+			continue;
+		}
+		// Skip . & ..
+		if (de[0] == '.') {
+			continue;
+		}
+
+		uint32_t first = ((uint32_t) fat_le16(de + 20) << 16U) | fat_le16(de + 26);
+		uint32_t size  = fat_le32(de + 28);
+		if (de[11] & FAT_ATTR_DIRECTORY) {
+			if (first < 2U || first > chk->max_cluster) {
+				chk->report->bad_dirents++;
+				continue;
+			}
+			int rc = fat_push_dir(chk, first);
+			if (rc != EXIT_SUCCESS) {
+				return rc;
+			}
+		} else if (first == 0U) {
+			if (size != 0U) {
+				chk->report->size_mismatches++;
+			}
+		} else if (first > chk->max_cluster) {
+			chk->report->bad_dirents++;
+		} else {
+			uint32_t clusters = fat_walk_chain(chk, first);
+			uint64_t expected = ((uint64_t) size + chk->cluster_size - 1U) / chk->cluster_size;
+			if (clusters != expected) {
+				chk->report->size_mismatches++;
+			}
+		}
+	}
+	return EXIT_SUCCESS;
+}
+
+// Walk a directory's chain, claiming it, and checking its entries
+// NOTE: The end marker only ends the entries, the chain itself may very well go on (e.g., after a bunch of deletions),
+//       and those clusters are still allocated to the directory, so we keep claiming them.
+static int
+    fat_check_dir(FATChecker* chk, uint32_t cluster)
+{
+	bool ended = false;
+	while (true) {
+		if (cluster < 2U || cluster > chk->max_cluster) {
+			chk->report->bad_links++;
+			break;
+		}
+		if (fat_bitmap_test_and_set(chk->owned, cluster)) {
+			chk->report->cross_links++;
+			break;
+		}
+
+		if (!ended) {
+			off64_t offset = (off64_t) (chk->m.data_offset + (uint64_t) (cluster - 2U) * chk->cluster_size);
+			if (pread64(chk->fd, chk->buf, chk->cluster_size, offset) != (ssize_t) chk->cluster_size) {
+				FAT_PFLOG(LOG_WARNING, "Short read on cluster %u", cluster);
+				return -EIO;
+			}
+			int rc = fat_check_dirents(chk);
+			if (rc < 0) {
+				return rc;
+			}
+			ended = rc == 1;
+		}
+
+		uint32_t next = chk->fat[cluster] & FAT32_ENTRY_MASK;
+		if (next >= FAT32_EOC_MIN) {
+			break;
+		} else if (next == 0U) {
+			chk->report->free_links++;
+			break;
+		} else if (next == FAT32_BAD_CLUSTER) {
+			chk->report->bad_links++;
+			break;
+		}
+		cluster = next;
+	}
+	return EXIT_SUCCESS;
+}
+
+// Check the structural consistency of a FAT32 volume: FAT copies, cluster chains, cross-links, lost clusters,
+// and chain lengths vs. file sizes, by mmapping the FAT & walking the directory tree.
+// NOTE: This is read-only, actual repairs are left to dosfsck.
+//       Returns a negative error code if the check itself failed, 0 otherwise (with the findings in *report).
+__attribute__((unused)) static int
+    fat_check_volume(const char* device, FATCheckReport* report)
+{
+	memset(report, 0, sizeof(*report));
+	FATChecker chk = { 0 };
+	chk.report     = report;
+	chk.m.map      = MAP_FAILED;
+	int rc         = EXIT_SUCCESS;
+
+	chk.fd = open(device, O_RDONLY | O_CLOEXEC | O_LARGEFILE);
+	if (chk.fd == -1) {
+		rc = -errno;
+		FAT_PFLOG(LOG_WARNING, "open(\"%s\"): %m", device);
+		return rc;
+	}
+
+	unsigned char bs[FAT_BS_SIZE] = { 0 };
+	if (pread64(chk.fd, bs, sizeof(bs), 0) != (ssize_t) sizeof(bs)) {
+		FAT_PFLOG(LOG_WARNING, "Short read on the boot sector of %s", device);
+		rc = -EIO;
+		goto cleanup;
+	}
+	rc = fat_parse_boot_sector(bs, &chk.vol);
+	if (rc != EXIT_SUCCESS) {
+		goto cleanup;
+	}
+
+	rc = fat_map(chk.fd, &chk.vol, &chk.m);
+	if (rc != EXIT_SUCCESS) {
+		goto cleanup;
+	}
+	chk.fat          = chk.m.fat;
+	chk.max_cluster  = chk.m.max_cluster;
+	chk.cluster_size = chk.m.cluster_size;
+	report->clusters = chk.m.clusters;
+
+	// Compare the FAT copies, starting at the first data cluster (FAT[1] holds the volume flags)
+	// NOTE: Unless mirroring is disabled, in which case the other copies are expected to be stale.
+	size_t   used = (size_t) (chk.max_cluster - 1U) * sizeof(uint32_t);
+	uint32_t fats = (chk.vol.ext_flags & FAT32_EXT_NO_MIRROR) ? 1U : chk.vol.num_fats;
+	for (uint32_t i = 1U; i < fats; i++) {
+		const unsigned char* first = (const unsigned char*) chk.fat;
+		const unsigned char* copy  = first + chk.m.fat_size * i;
+		if (memcmp(first + 2U * sizeof(uint32_t), copy + 2U * sizeof(uint32_t), used) != 0) {
+			report->fat_mismatches++;
+		}
+	}
+
+	// Check every entry in one pass
+	report->bad_links += fat_scan_entries(chk.fat, chk.max_cluster, &report->free_clusters, NULL);
+
+	// Walk the directory tree, claiming clusters as we go
+	chk.owned = calloc(chk.max_cluster / 8U + 1U, sizeof(*chk.owned));
+	chk.buf   = malloc(chk.cluster_size);
+	if (!chk.owned || !chk.buf) {
+		rc = -ENOMEM;
+		FAT_PFLOG(LOG_ERR, "malloc: %m");
+		goto cleanup;
+	}
+	madvise(chk.m.map, chk.m.map_size, MADV_RANDOM);
+	rc = fat_push_dir(&chk, chk.vol.root_cluster);
+	while (rc == EXIT_SUCCESS && chk.dirs_count > 0U) {
+		rc = fat_check_dir(&chk, chk.dirs[--chk.dirs_count]);
+	}
+	if (rc != EXIT_SUCCESS) {
+		goto cleanup;
+	}
+
+	// Anything that's allocated but wasn't claimed is lost
+	for (uint32_t c = 2U; c <= chk.max_cluster; c++) {
+		uint32_t e = chk.fat[c] & FAT32_ENTRY_MASK;
+		if (e != 0U && e != FAT32_BAD_CLUSTER && !fat_bitmap_test(chk.owned, c)) {
+			report->lost_clusters++;
+		}
+	}
+
+cleanup:
+	fat_unmap(&chk.m);
+	free(chk.owned);
+	free(chk.buf);
+	free(chk.dirs);
+	close(chk.fd);
+	return rc;
+}
+
+__attribute__((unused)) static bool
+    fat_report_is_clean(const FATCheckReport* report)
+{
+	return report->bad_links == 0U && report->free_links == 0U && report->cross_links == 0U &&
+	       report->size_mismatches == 0U && report->bad_dirents == 0U && report->lost_clusters == 0U &&
+	       report->fat_mismatches == 0U;
+}
+
+// Flag a volume we've just checked as cleanly unmounted, like dosfsck -a does when it doesn't find anything to fix.
+__attribute__((unused)) static int
+    fat_clear_dirty(const char* device)
+{
+	int fd = open(device, O_RDWR | O_CLOEXEC | O_LARGEFILE);
+	if (fd == -1) {
+		int rc = -errno;
+		FAT_PFLOG(LOG_WARNING, "open(\"%s\"): %m", device);
+		return rc;
+	}
+
+	int           rc              = EXIT_SUCCESS;
+	unsigned char bs[FAT_BS_SIZE] = { 0 };
+	FATVolume     vol             = { 0 };
+	if (pread64(fd, bs, sizeof(bs), 0) != (ssize_t) sizeof(bs) || fat_parse_boot_sector(bs, &vol) != EXIT_SUCCESS) {
+		rc = -EINVAL;
+		goto cleanup;
+	}
+
+	// Boot sector state (Linux)
+	if (bs[FAT_BS_STATE] & FAT_STATE_DIRTY) {
+		unsigned char state = (unsigned char) (bs[FAT_BS_STATE] & ~FAT_STATE_DIRTY);
+		if (pwrite64(fd, &state, sizeof(state), FAT_BS_STATE) != (ssize_t) sizeof(state)) {
+			rc = -EIO;
+			goto cleanup;
+		}
+	}
+
+	// FAT[1] flags (Windows & macOS), in every FAT copy
+	for (uint32_t i = 0U; i < vol.num_fats; i++) {
+		off64_t  offset = (off64_t) (vol.reserved_sectors + (uint64_t) i * vol.fat_sectors) * vol.bytes_per_sector +
+				 (off64_t) sizeof(uint32_t);
+		uint32_t entry  = 0U;
+		if (pread64(fd, &entry, sizeof(entry), offset) != (ssize_t) sizeof(entry)) {
+			rc = -EIO;
+			goto cleanup;
+		}
+		entry |= FAT32_CLN_SHUT_BIT | FAT32_HRD_ERR_BIT;
+		if (pwrite64(fd, &entry, sizeof(entry), offset) != (ssize_t) sizeof(entry)) {
+			rc = -EIO;
+			goto cleanup;
+		}
+	}
+
+	if (fsync(fd) == -1) {
+		rc = -errno;
+	}
+
+cleanup:
+	if (rc != EXIT_SUCCESS) {
+		FAT_PFLOG(LOG_WARNING, "Failed to clear the dirty flags on %s (%s)", device, strerror(-rc));
+	}
+	close(fd);
+	return rc;
+}
+
+// Recount the free clusters of a volume, and rewrite its FSInfo sector if it's stale
+// (some hosts, e.g., macOS, don't bother keeping it up to date).
+// Returns 1 if the FSInfo sector was updated, 0 if it was already accurate, or a negative error code.
+// The fresh free cluster count & next free cluster hint are stored in *free_clusters & *next_free.
+__attribute__((unused)) static int
+    fat_update_fsinfo(const char* device, uint32_t* free_clusters, uint32_t* next_free)
+{
+	int fd = open(device, O_RDWR | O_CLOEXEC | O_LARGEFILE);
+	if (fd == -1) {
+		int rc = -errno;
+		FAT_PFLOG(LOG_WARNING, "open(\"%s\"): %m", device);
+		return rc;
+	}
+
+	int           rc              = EXIT_SUCCESS;
+	FATMapping    m               = { .map = MAP_FAILED };
+	FATVolume     vol             = { 0 };
+	unsigned char bs[FAT_BS_SIZE] = { 0 };
+	if (pread64(fd, bs, sizeof(bs), 0) != (ssize_t) sizeof(bs)) {
+		rc = -EIO;
+		goto cleanup;
+	}
+	rc = fat_parse_boot_sector(bs, &vol);
+	if (rc != EXIT_SUCCESS) {
+		goto cleanup;
+	}
+	// FSInfo lives in the reserved area (and 0 or 0xFFFF mean there isn't one)
+	if (vol.fsinfo_sector == 0U || vol.fsinfo_sector >= vol.reserved_sectors) {
+		rc = -ENOTSUP;
+		goto cleanup;
+	}
+
+	unsigned char fsi[FAT_BS_SIZE] = { 0 };
+	off64_t       fsi_offset       = (off64_t) vol.fsinfo_sector * vol.bytes_per_sector;
+	if (pread64(fd, fsi, sizeof(fsi), fsi_offset) != (ssize_t) sizeof(fsi)) {
+		rc = -EIO;
+		goto cleanup;
+	}
+	if (fat_le32(fsi + FAT_FSI_LEAD_SIG) != FAT_FSI_LEAD_MAGIC ||
+	    fat_le32(fsi + FAT_FSI_STRUC_SIG) != FAT_FSI_STRUC_MAGIC ||
+	    fat_le32(fsi + FAT_FSI_TRAIL_SIG) != FAT_FSI_TRAIL_MAGIC) {
+		rc = -EINVAL;
+		goto cleanup;
+	}
+
+	rc = fat_map(fd, &vol, &m);
+	if (rc != EXIT_SUCCESS) {
+		goto cleanup;
+	}
+	uint32_t first_free = 0U;
+	fat_scan_entries(m.fat, m.max_cluster, free_clusters, &first_free);
+	*next_free = first_free ? first_free : FAT_FSI_UNKNOWN;
+
+	if (fat_le32(fsi + FAT_FSI_FREE_COUNT) == *free_clusters && fat_le32(fsi + FAT_FSI_NXT_FREE) == *next_free) {
+		goto cleanup;
+	}
+
+	// Both fields are contiguous, and we're little-endian
+	uint32_t fields[2] = { *free_clusters, *next_free };
+	if (pwrite64(fd, fields, sizeof(fields), fsi_offset + FAT_FSI_FREE_COUNT) != (ssize_t) sizeof(fields)) {
+		rc = -EIO;
+		goto cleanup;
+	}
+	if (fsync(fd) == -1) {
+		rc = -errno;
+		goto cleanup;
+	}
+	rc = 1;
+
+cleanup:
+	if (rc < 0) {
+		FAT_PFLOG(LOG_WARNING, "Failed to update the FSInfo sector of %s (%s)", device, strerror(-rc));
+	}
+	fat_unmap(&m);
+	close(fd);
+	return rc;
+}
+
+#endif    // __FAT_H
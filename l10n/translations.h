@@ -0,0 +1,1404 @@
+// Generated by tools/po2c.py from po/*/usbms.po, do not edit! (c.f., make l10n)
+
+#ifndef __USBMS_TRANSLATIONS_H
+#define __USBMS_TRANSLATIONS_H
+
+#define TR_SEED  0x0000001DU
+#define TR_SLOTS 128U
+#define TR_COUNT 27U
+
+// Hash slot -> msgid index + 1 (0 if empty)
+static const uint8_t tr_slots[TR_SLOTS] = {
+	 0,  0, 22,  2,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 25,
+	 0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  3, 13,
+	 0,  0,  0,  0,  0, 16,  0,  0,  0,  0,  0,  7,  0, 17,  0,  0,
+	 0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+	 0, 19,  0,  0, 18,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0, 23,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,
+	 0,  0,  0,  0,  0, 26, 21,  0,  0,  0,  0,  0,  9,  0, 12,  0,
+	 0, 20,  0, 24,  0, 10,  0,  5,  0,  0,  0,  0,  0,  0,  4,  0,
+};
+
+static const char* const tr_msgids[TR_COUNT] = {
+	"Done!\nKOReader will now restart…",
+	"Ending USBMS session…",
+	"Press the power button to exit.",
+	"Starting USBMS session…",
+	"USB Mass Storage",
+	"USBMS session in progress.\nPlease eject your device safely before unplugging it.",
+	"Waiting to be plugged in…\nOr, press the power button to exit.",
+	" Gave up after 30 sec.\nKOReader will now restart…",
+	" Gave up after 30 sec.\nThe device will shut down in 90 sec.",
+	" Gave up after 60 sec.\nKOReader will now restart…",
+	" Gave up after 60 sec.\nThe device will shut down in 90 sec.",
+	" KOReader will now restart…",
+	" Could not detect an unplug event!\nThe device will shut down in 90 sec.",
+	" Could not end the USBMS session!\nThe device will shut down in 90 sec.",
+	" Could not run the fuser script!",
+	" Could not start the USBMS session!\nThe device will shut down in 90 sec.",
+	" Filesystem is busy! Offending processes:",
+	" Please disable USBNet manually!\nPress the power button to exit.",
+	" Please disable USBSerial manually!\nPress the power button to exit.",
+	" Please disable your custom USB gadget manually!\nPress the power button to exit.",
+	" Please take the device out of the PowerCover!\nPress the power button to exit.",
+	" The device is plugged into a plain power source, not a USB host!\nKOReader will now restart…",
+	" The device is plugged into a plain power source, not a USB host!\nThe device will shut down in 90 sec.",
+	" The device was plugged into a plain power source, not a USB host!\nKOReader will now restart…",
+	" The device was plugged into a plain power source, not a USB host!\nThe device will shut down in 90 sec.",
+	" The device will shut down in 90 sec.",
+	" The fuser script failed!",
+};
+
+static const char* const tr_ar[TR_COUNT] = {
+	[0] = "تمَّ!\nسيعاد تشغيل KOReader الآن …",
+	[1] = "إنهاء جلسة (USBMS) …",
+	[2] = "اضغط زرّ التشغيل للخروج.",
+	[3] = "جارٍ بدء جلسة الخَزْن عبر USB (أو USBMS) …",
+	[4] = "تخزين USB كبير السعة",
+	[5] = "جلسة الخَزْن عبر USB (أو USBMS) جاريةٌ الآن.\nفضلًا قم بفصل الجهاز عن الكمبيوتر (eject) بطريقةٍ سليمة قبل فصل السّلك.",
+	[6] = "قيد الانتظار لوصل الجهاز …\nأو اضغط زرّ التشغيل للخروج.",
+	[7] = " استسلم بعد 30 ثانية.\nسيتم إعادة تشغيل KOReader الآن…",
+	[8] = " توقفت المحاولة بعد 30 ثانية\nسيتم إيقاف التشغيل خلال 90 ثانية.",
+	[9] = " تم التوقف بعد 60 ثانية.\nسيتم إعادة تشغيل KOReader الآن …",
+	[10] = " تم التوقف بعد 60 ثانية.\nسيتم إغلاق الجهاز خلال 90 ثانية.",
+	[11] = " سيتم إعادة تشغيل KOReader الآن …",
+	[12] = " لم يتم التأكد من فصل السلك!\nسيتم إغلاق الجهاز في غضون 90 ثانية.",
+	[13] = "□ تعذر إنهاء جلسة USBMS!\nسيتم إيقاف تشغيل الجهاز في 90 ثانية.",
+	[14] = "□ فشل تشغيل أداة (fuser)!",
+	[15] = " تعذر بدء جلسة USBMS!\nسيتم إغلاق الجهاز في غضون 90 ثانية.",
+	[16] = " النظام قيد الاستخدام! العمليات الجارية:",
+	[17] = " الرجاء القيام بإلغاء تفعيل الشبكة عبر USB أو USBNet يدويًّا!\nاضغط زرّ التشغيل للخروج.",
+	[18] = " الرجاء القيام بإلغاء تفعيل المنفذ التسلسلي عبر USB أو USBSerial يدويًّا!\nاضغط زرّ التشغيل للخروج.",
+	[19] = " يرجى تعطيل إعدادات USB المخصصة يدوياً.\nاضغط على زر التشغيل للخروج.",
+	[20] = " الرجاء إخراج الجهاز من (PowerCover)!\nاضغط زرّ التشغيل للخروج.",
+	[21] = " الجهاز متصل بمصدر للطاقة ، وليس مضيف USB!\nسيتم إعادة تشغيل KOReader الآن …",
+	[22] = " الجهاز متصل بمصدر للطاقة ، وليس مضيف USB!\nسيتم إغلاق الجهاز في غضون 90 ثانية.",
+	[23] = " تم توصيل الجهاز بمصدر طاقة عادي ، وليس بمضيف USB!\nسيتم إعادة تشغيل KOReader الآن…",
+	[24] = " تم توصيل الجهاز بمصدر طاقة عادي ، وليس بمضيف USB!\nسيتم إغلاق الجهاز خلال 90 ثانية.",
+	[25] = "□ سيتم إطفاء الجهاز خلال 90 ثانية.",
+	[26] = " أداة (fuser) فشلت!",
+};
+
+static const char* const tr_bg[TR_COUNT] = {
+	[0] = "Готово!\nKOReader рестартира…",
+	[1] = "Затваряне на USBMS сесията…",
+	[2] = "Натиснете копчето за изключване за да излезете.",
+	[3] = "Стартира се USBMS сесия…",
+	[4] = "Външна памет на USB",
+	[5] = "В ход е USBMS сесия.\nМоля, отвържете устройството си безопасно преди да прекъснете USB връзката.",
+	[6] = "Изчаква се свързване с кабел...\nИли натиснете копчето за изключване за да излезете.",
+	[7] = " Прекратяване на опитите след 30 сек.\nKOReader рестартира…",
+	[8] = " Прекратяване на опитите след 30 сек.\nУстройството ще изключи след 90 сек.",
+	[9] = " Прекратяване на опитите след 60 сек.\nKOReader рестартира…",
+	[10] = " Прекратяване на опитите след 60 сек.\nУстройството ще изключи след 90 сек.",
+	[11] = " KOReader рестартира…",
+	[12] = " Грешка при установяване на събитие на изключване!\nУстройството ще изключи след 90 сек.",
+	[13] = " Неуспешно приключване на сеанс на USBMS!\nУстройството ще изключи след 90 сек.",
+	[14] = " Грешка при изпълнение на скрипта на fuser!",
+	[15] = " Грешка при стартиране на сеанс на USBMS!\nУстройството ще изключи след 90 сек.",
+	[16] = " Файловата система е заета! Виновни процеси:",
+	[17] = " Моля, изключете USBNet ръчно!\nНатиснете копчето за изключване за да излезете.",
+	[18] = " Моля, изключете USBSerial ръчно!\nНатиснете копчето за изключване за да излезете.",
+	[19] = " Ръчно изключете USB устройството!\nЗа да излезете, натиснете копчето за изключване.",
+	[20] = " Извадете устройството от PowerCover!\nЗа да излезете, натиснете копчето за изключване.",
+	[21] = " Устройството е включено в захранване, а не в друго устройство!\nKOReader рестартира…",
+	[22] = " Устройството е включено в захранване, а не в друго устройство!\nУстройството ще изключи след 90 сек.",
+	[23] = " Устройството е включено в захранване, а не в друго устройство!\nKOReader рестартира…",
+	[24] = " Устройството е включено в захранване, а не в друго устройство!\nУстройството ще изключи след 90 сек.",
+	[25] = " Устройството ще изключи след 90 сек.",
+	[26] = " Fuser скриптът не завърши успешно!",
+};
+
+static const char* const tr_bn[TR_COUNT] = {
+	[0] = "সম্পন্ন!\nকোরিডার এখন পুনরায় চালু হবে …",
+	[1] = "ইউএসবিএমএস সেশন শেষ হচ্ছে…",
+	[2] = "প্রস্থান করতে পাওয়ার বোতামটি টিপুন।",
+	[3] = "ইউএসবিএমএস সেশন শুরু হচ্ছে…",
+	[5] = "ইউএসবিএমএস সেশন চলছে।\nআপনার ডিভাইসটি আনপ্লাগ করার আগে অনুগ্রহ করে নিরাপদে বের করুন।",
+	[6] = "প্লাগ ইন করার জন্য অপেক্ষা করা হচ্ছে...\nঅথবা, প্রস্থান করতে পাওয়ার বোতামটি টিপুন।",
+	[7] = " ৩০ সেকেন্ড পরে হাল ছেড়ে দেন।\nকেওরিডার এখন পুনরায় শুরু হবে…",
+	[8] = " ৩০ সেকেন্ড পরে হার মানলাম।\nডিভাইসটি ৯০ সেকেন্ডের মধ্যে বন্ধ হয়ে যাবে।",
+	[9] = " ৬০ সেকেন্ড পরে হার মানলাম।\nকেওরিডার এখন পুনরায় শুরু হবে…",
+	[10] = " ৬০ সেকেন্ড পরে হার মানলাম।\nডিভাইসটি ৯০ সেকেন্ডের মধ্যে বন্ধ হয়ে যাবে।",
+	[11] = "OR কোরিডার এখন পুনরায় চালু হবে …",
+	[12] = " একটি আনপ্লাগ ঘটনা শনাক্ত করতে পারিনি!\nযন্ত্রটি ৯০ সেকেন্ডে বন্ধ হয়ে যাবে।",
+	[13] = " ইউএসবিএমএস সেশন শেষ করতে পারিনি!\nযন্ত্রটি ৯০ সেকেন্ডে বন্ধ হয়ে যাবে।",
+	[14] = " ফিউজার স্ক্রিপ্টটি চালানো যায়নি!",
+	[15] = " ইউএসবিএমএস সেশন শুরু করতে পারিনি!\nযন্ত্রটি ৯০ সেকেন্ডে বন্ধ হয়ে যাবে।",
+	[16] = " ফাইলসিস্টেম ব্যস্ত! আপত্তিকর প্রক্রিয়া:",
+	[17] = " ইউএসবি নেট ম্যানুয়ালি বন্ধ করুন!\nপ্রস্থান করতে পাওয়ার বাটন চাপুন।",
+	[18] = " অনুগ্রহ করে ম্যানুয়ালি ইউএসবিসিরিয়াল অক্ষম করুন!\nপ্রস্থান করতে পাওয়ার বোতামটি টিপুন।",
+	[19] = " অনুগ্রহ করে আপনার কাস্টম ইউএসবি গ্যাজেট ম্যানুয়ালি অক্ষম করুন!\nপ্রস্থান করতে পাওয়ার বোতাম টিপুন।",
+	[20] = " অনুগ্রহ করে, পাওয়ারকভার থেকে ডিভাইসটি বের করে আনুন!\nপ্রস্থান করতে পাওয়ার বোতাম টিপুন।",
+	[21] = " ডিভাইসটি একটি সাধারণ পাওয়ার সোর্সে প্লাগ করা হয়েছে, কোনও ইউএসবি হোস্টে নয়!\nকেওরিডার এখন পুনরায় শুরু হবে…",
+	[22] = " ডিভাইসটি একটি সাধারণ পাওয়ার উৎসে লাগানো হয়েছিল, কোনও ইউএসবি হোস্টে নয়!\nডিভাইসটি ৯০ সেকেন্ডের মধ্যে বন্ধ হয়ে যাবে।",
+	[23] = " ডিভাইসটি একটি সাধারণ পাওয়ার সোর্সে প্লাগ করা হয়েছিল, কোনও ইউএসবি হোস্ট নয়!\nকেওরিডার এখন পুনরায় শুরু হবে…",
+	[24] = " ডিভাইসটি একটি সাধারণ পাওয়ার সোর্সে প্লাগ করা হয়েছিল, কোনও ইউএসবি হোস্ট নয়!\nডিভাইসটি ৯০ সেকেন্ডে হয়ে যাবে।",
+	[25] = " ডিভাইসটি ৯০ সেকেন্ডে বন্ধ হয়ে যাবে।",
+	[26] = " ফাউজার স্ক্রিপ্ট ব্যর্থ হয়েছে!",
+};
+
+static const char* const tr_ca[TR_COUNT] = {
+	[0] = "Fet.\nEl KOReader es reiniciarà en breu…",
+	[1] = "S’està finalitzant la sessió USBMS…",
+	[2] = "Premeu el botó d’engegada per a sortir.",
+	[3] = "Iniciant sessió USBMS…",
+	[4] = "Emmagatzematge massiu USB",
+	[5] = "Sessió de USBMS en curs.\nÉs necessari expulsar el dispositiu de manera segura abans de desconnectar-lo.",
+	[6] = "Esperar que es realitze la connexió…\nO pressionar el botó d'engegada per a sortir.",
+	[7] = " Es desisteix després de 30 segons.\nEl KOReader es reiniciarà en breu…",
+	[8] = " Es desisteix després de 30 segons.\nEl dispositiu s’apagarà en 90 segons.",
+	[9] = " Es desisteix després de 60 segons.\nEl KOReader es reiniciarà en breu…",
+	[10] = " Es desisteix després de 60 segons.\nEl dispositiu s’apagarà en 90 segons.",
+	[11] = " KOReader es reiniciarà en breu…",
+	[12] = " No s'ha pogut detectar un event de desconnexió!\nEl dispositiu s'apagarà en 90 segons.",
+	[13] = " No s'ha pogut finalitzar la sessió USBMS!\nEl dispositiu s'apagarà en 90 segons.",
+	[14] = " No s’ha pogut executar l’script «fuser».",
+	[15] = " No s'ha pogut iniciar la sessió USBMS!\nEl dispositiu s'apagarà en 90 segons.",
+	[16] = " El sistema de fitxers està ocupat. Processos infractors:",
+	[17] = " Desactiveu USBNet manualment.\nPremeu el botó d’engegada per a sortir.",
+	[18] = " Desactiveu USBSerial manualment.\nPremeu el botó d’engegada per a sortir.",
+	[19] = " Desactiveu USBNet manualment.\nPremeu el botó d’engegada per sortir.",
+	[20] = " Traure el dispositiu de la funda PowerCover!\nPressionar el botó d'encesa per a sortir.",
+	[21] = " El dispositiu està connectat a una font d'alimentació, no a un host USB!\nAra KOReader es reiniciarà…",
+	[22] = " El dispositiu està connectat a una font d'alimentació, no a un host USB!\nEl dispositiu s'apagarà en 90 segons.",
+	[23] = " El dispositiu està connectat a una font d'alimentació, no a un host USB!\nAra KOReader es reiniciarà…",
+	[24] = " El dispositiu està connectat a una font d'alimentació, no a un host USB!\nEl dispositiu s'apagarà en 90 segons.",
+	[25] = " El dispositiu s'apagarà en 90 segons.",
+	[26] = " Ha fallat l’script «fuser».",
+};
+
+static const char* const tr_cs[TR_COUNT] = {
+	[0] = "Hotovo!\nKOReader bude nyní restartován…",
+	[1] = "Ukončování USBMS relace…",
+	[2] = "Pro ukončení stiskněte tlačítko napájení.",
+	[3] = "Zahajování USBMS relace…",
+	[4] = "USB úložiště",
+	[5] = "Probíhá USBMS relace.\nProsím odeberte bezpečně vaše zařízení předtím, než ho odpojíte.",
+	[6] = "Čekání na připojení k napájení…\nNebo pro ukončení stiskněte tlačítko napájení.",
+	[7] = " Ukončeno po 30 s.\nKOReader bude restartován…",
+	[8] = " Ukončeno po 30 s.\nZařízení bude vypnuto za 90 s.",
+	[9] = " Ukončeno po 60 s.\nKOReader bude restartován…",
+	[10] = " Ukončeno po 60 s.\nZařízení bude vypnuto za 90 s.",
+	[11] = " KOReader bude nyní restartován…",
+	[12] = " Nepodařilo se detekovat událost odpojení!\nZařízení bude vypnuto za 90 s.",
+	[13] = " Nepodařilo se ukončit USBMS relaci!\nZařízení bude vypnuto za 90 s.",
+	[14] = " Nepodařilo se spustit fuser skript!",
+	[15] = " Nepodařilo se zahájit USBMS relaci!\nZařízení bude vypnuto za 90 s.",
+	[16] = " Souborový systém je zaneprázdněn! Zodpovědné procesy:",
+	[17] = " Prosím manuálně zakažte USBNet!\nPro ukončení stiskněte tlačítko napájení.",
+	[18] = " Prosím manuálně zakažte USBSerial!\nPro ukončení stiskněte tlačítko napájení.",
+	[19] = " Prosím manuálně zakažte svůj USB gadget!\nPro ukončení stiskněte tlačítko napájení.",
+	[20] = " Vyjměte prosím zařízení z napájecího krytu!\nPro ukončení stiskněte tlačítko napájení.",
+	[21] = " Zařízení je připojeno k obyčejnému zdroji a ne k USB hostiteli!\nKOReader bude nyní restartován.…",
+	[22] = " Zařízení bylo připojeno k obyčejnému zdroji a ne k USB hostiteli!\nZařízení bude vypnuto za 90 s.",
+	[23] = " Zařízení bylo připojeno k obyčejnému zdroji a ne k USB hostiteli!\nKOReader bude nyní restartován.…",
+	[24] = " Zařízení bylo připojeno k obyčejnému zdroji a ne k USB hostiteli!\nZařízení bude vypnuto za 90 s.",
+	[25] = " Zařízení bude vypnuto za 90 s.",
+	[26] = " fuser skript selhal!",
+};
+
+static const char* const tr_cy[TR_COUNT] = {
+	[0] = "Wedi'i wneud!\nBydd KOReader yn ailgychwyn nawr…",
+	[1] = "Yn cwblhau sesiwn USBMS…",
+	[2] = "Pwyswch y botwm pŵer i adael.",
+	[3] = "Yn dechrau sesiwn USBMS…",
+	[4] = "Storfa USB Crynswth",
+	[5] = "Mae sesiwn USBMS yn rhedeg nawr.\nCyn ichi ei dad-blygio, dad-fowntiwch eich dyfais yn ddiogel.",
+	[6] = "Yn aros i gael ei phlygio i mewn…\nNeu, pwyswch y botwm pŵer i adael.",
+	[7] = " Wedi rhoi i fyny ar ôl 30 eiliad.\nBydd KOReader yn ailgychwyn nawr…",
+	[8] = " Wedi rhoi i fyny ar ôl 30 eiliad.\nBydd y ddyfais yn cau mewn 90 eiliad.",
+	[9] = " Wedi rhoi i fyny ar ôl 60 eiliad.\nBydd KOReader yn ailgychwyn nawr…",
+	[10] = " Wedi rhoi i fyny ar ôl 60 eiliad.\nBydd y ddyfais yn cau mewn 90 eiliad.",
+	[11] = " Bydd KOReader yn ailgychwyn nawr…",
+	[12] = " Methodd sylwi digwyddiad dad-blygio!\nBydd y ddyfais yn cau mewn 90 eiliad.",
+	[13] = " Methodd orffen y sesiwn USBMS!\nBydd y ddyfais yn cau mewn 90 eiliad.",
+	[14] = " Methodd redeg sgript y fuser!",
+	[15] = " Methodd ddechrau y sesiwn USBMS!\nBydd y ddyfais yn cau mewn 90 eiliad.",
+	[16] = " Mae'r system ffeiliau yn brysur! Prosesau problematig:",
+	[17] = " Analluogwch USBNet â llaw!\nPwyswch y botwm pŵer i adael.",
+	[18] = " Analluogwch USBSerial â llaw!\nPwyswch y botwm pŵer i adael.",
+	[19] = " Analluogwch USBNet â llaw os gwelwch yn dda!\nPwyswch y botwm pŵer i adael.",
+	[20] = " Tynnwch y ddyfais allan o'r PowerCover!\nPwyswch y botwm pŵer i adael.",
+	[21] = " Mae'r ddyfais yn cael ei chysylltu â ffynhonnell pŵer cyffredin, yn lle gwesteiwr USB!\nBydd KOReader ailgychwyn nawr…",
+	[22] = " Mae'r ddyfais yn cael ei chysylltu â ffynhonnell pŵer cyffredin, yn lle gwesteiwr USB!\nBydd y ddyfais yn cau mewn 90 eiliad.",
+	[23] = " Cafodd y ddyfais ei chysylltu â ffynhonnell pŵer cyffredin, yn lle gwesteiwr USB!\nBydd KOReader ailgychwyn nawr…",
+	[24] = " Cafodd y ddyfais ei chysylltu â ffynhonnell pŵer cyffredin, yn lle gwesteiwr USB!\nBydd y ddyfais yn cau mewn 90 eiliad.",
+	[25] = " Bydd y ddyfais yn cau mewn 90 eiliad.",
+	[26] = " Mae'r sgript fuser wedi methu!",
+};
+
+static const char* const tr_da[TR_COUNT] = {
+	[0] = "Færdig!\nKOReader vil nu genstarte…",
+	[1] = "Afslutter USBMS session…",
+	[2] = "Tryk på tænd/sluk-knappen for at afslutte.",
+	[3] = "Starter USBMS session…",
+	[4] = "USB lager",
+	[5] = "USBMS session er i gang.\nVenligst fjern din enhed sikkert før du hiver stikket ud.",
+	[6] = "Venter på at blive tilsluttet…\nEller du kan trykke på tænd/sluk-knappen for at afslutte.",
+	[7] = " Opgav efter 30 sek.\nKOReader vil nu genstarte…",
+	[8] = " Gav op efter 30 sek.\nEnheden vil lukke ned om 90 sek.",
+	[9] = " Opgav efter 60 sek.\nKOReader vil nu genstarte…",
+	[10] = " Gav op efter 60 sek.\nEnheden vil lukke ned om 90 sek.",
+	[11] = " KOReader vil nu genstarte…",
+	[12] = " Kunne ikke registrere en afkoblingshændelse!\nEnheden vil lukke ned om 90 sek.",
+	[13] = " Kunne ikke afslutte USBMS-sessionen!\nEnheden vil lukke ned om 90 sek.",
+	[14] = " Kunne ikke køre fuser-scriptet!",
+	[15] = " Kunne ikke starte USBMS sessionen!\nEnheden vil lukke ned om 90 sek.",
+	[16] = " Filsystemet er optaget! Skyldige processer:",
+	[17] = " Deaktiver venligst USBNet manuelt!\nTryk på tænd/sluk-knappen for at afslutte.",
+	[18] = " Deaktiver venligst USBSerial manuelt!\nTryk på tænd/sluk-knappen for at afslutte.",
+	[19] = " Deaktiver venligst USB-dims manuelt!\nTryk på tænd/sluk-knappen for at afslutte.",
+	[20] = " Tag venligst enheden ud af PowerCoveret !\nTryk på tænd/sluk-knappen for at afslutte.",
+	[21] = " Enheden blev tilsluttet til en strømkilde og ikke til en USB-host!\nKOReader vil nu genstarte…",
+	[22] = " Enheden blev tilsluttet til en strømkilde og ikke til en USB-host!\nEnheden vil lukke ned om 90 sek.",
+	[23] = " Enheden blev tilsluttet til en strømkilde og ikke til en USB-vært!\nKOReader vil nu genstarte…",
+	[24] = " Enheden blev tilsluttet til en strømkilde og ikke til en USB-vært!\nEnheden vil lukke ned om 90 sek.",
+	[25] = " Enheden vil lukke ned om 90 sek.",
+	[26] = " Fuser-scriptet fejlede!",
+};
+
+static const char* const tr_de[TR_COUNT] = {
+	[0] = "Erledigt!\nKOReader wird jetzt neu starten…",
+	[1] = "Beenden der USBMS-Sitzung…",
+	[2] = "Drücken Sie zum Beenden den Netzschalter.",
+	[3] = "USBMS-Sitzung starten…",
+	[4] = "USB-Massenspeicher",
+	[5] = "USBMS-Sitzung läuft.\nBitte werfen Sie Ihr Gerät sicher aus, bevor Sie es trennen.",
+	[6] = "Warten darauf, eingesteckt zu werden…\nOder drücken Sie die Einschalttaste zum Beenden.",
+	[7] = " Gab nach 30 Sekunden auf.\nKOReader wird nun wieder starten…",
+	[8] = " Gab nach 30 Sekunden auf.\nDas Gerät schaltet sich nach 90 Sekunden ab.",
+	[9] = " Gab nach 60 Sekunden auf.\nKOReader wird nun wieder starten…",
+	[10] = " Gab nach 60 Sekunden auf.\nDas Gerät schaltet sich in 90 Sekunden ab.",
+	[11] = " KOReader wird jetzt neu starten…",
+	[12] = " Es ist fehlgeschlagen, ein Unplug-Ereignis zu entdecken!\nDas Gerät schaltet sich in 90 Sekunden ab.",
+	[13] = " Die USBMS-Sitzung konnte nicht beendet werden!\nDas Gerät schaltet sich in 90 Sekunden ab.",
+	[14] = " Das Fuser-Skript konnte nicht ausgeführt werden!",
+	[15] = " Die USBMS-Sitzung konnte nicht gestartet werden!\nDas Gerät schaltet sich in 90 Sekunden ab.",
+	[16] = " Das Dateisystem ist beschäftigt! Angreifende Prozesse:",
+	[17] = " Bitte deaktivieren Sie USBNet manuell!\nDrücken Sie zum Beenden den Netzschalter.",
+	[18] = " Bitte deaktivieren Sie USBSerial manuell!\nZum Beenden drücken Sie den Netzschalter.",
+	[19] = " Bitte deaktivieren Sie das USB Gerät manuell!\nDrücken Sie zum Beenden den Netzschalter.",
+	[20] = " Bitte entnehmen Sie das Gerät aus dem SleepCover! \nDrücken Sie zum Beenden den Ein/Ausschalter.",
+	[21] = " Das Gerät ist an eine einfache Stromquelle angeschlossen, nicht an einen USB-Host!\nKOReader wird nun neu gestartet…",
+	[22] = " Das Gerät ist an eine einfache Stromquelle angeschlossen, nicht an einem USB-Host!\nDas Gerät schaltet sich in 90 Sekunden ab.",
+	[23] = " Das Gerät war an eine einfache Stromquelle angeschlossen, nicht an einen USB-Host!\nKOReader wird nun neu gestartet…",
+	[24] = " Das Gerät war an eine einfache Stromquelle angeschlossen, nicht an einem USB-Host!\nDas Gerät schaltet sich in 90 Sekunden ab.",
+	[25] = " Das Gerät schaltet sich in 90 Sekunden ab.",
+	[26] = " Das Fuser-Skript ist fehlgeschlagen!",
+};
+
+static const char* const tr_eo[TR_COUNT] = {
+	[3] = "Komencante seancon de USBMS…",
+	[4] = "Amasa Konservejo per USB",
+	[11] = " KOReader nun relanĉiĝos…",
+	[16] = " Dosiersistemo estas okupata! Okupantaj procezoj:",
+	[26] = " La fuser-programeto malsukcesis!",
+};
+
+static const char* const tr_es[TR_COUNT] = {
+	[0] = "¡Listo!\nAhora KOReader se reiniciará…",
+	[1] = "Finalizando la sesión USBMS…",
+	[2] = "Presione el botón de encendido para salir.",
+	[3] = "Iniciando la sesión USBMS…",
+	[4] = "Almacenamiento masivo USB",
+	[5] = "Sesión de USBMS en curso.\nEs necesario expulsar el dispositivo de forma segura antes de desconectarlo.",
+	[6] = "Esperando a que se enchufe…\nO presione el botón de encendido para salir.",
+	[7] = " Se ha desistido tras 30 segundos.\nAhora KOReader se reiniciará…",
+	[8] = " Se ha desistido tras 30 segundos.\nEl dispositivo se apagará en 90 segundos.",
+	[9] = " Se ha desistido tras 60 segundos.\nAhora KOReader se reiniciará…",
+	[10] = " Se ha desistido tras 60 segundos.\nEl dispositivo se apagará en 90 segundos.",
+	[11] = " Ahora KOReader se reiniciará…",
+	[12] = " No se ha podido detectar un evento de desenchufe.\nEl dispositivo se apagará en 90 segundos.",
+	[13] = " No se ha podido finalizar la sesión USBMS.\nEl dispositivo se apagará en 90 segundos.",
+	[14] = " No se ha podido ejecutar la utilidad «fuser».",
+	[15] = " No se ha podido iniciar la sesión USBMS.\nEl dispositivo se apagará en 90 segundos.",
+	[16] = " El sistema de archivos está ocupado. Procesos infractores:",
+	[17] = " ¡Deshabilitar USBNet manualmente!\nPresionar el botón de encendido para salir.",
+	[18] = " Desactive USBSerial manualmente.\nPresione el botón de encendido para salir.",
+	[19] = " ¡Por favor, desactiva tu gadget USB personalizado manualmente!\nPulsa el botón de encendido para salir.",
+	[20] = " Extraiga el dispositivo de la funda PowerCover.\nPresione el botón de encendido para salir.",
+	[21] = " El dispositivo se ha enchufado a una fuente de alimentación, no a un anfitrión USB.\nAhora KOReader se reiniciará…",
+	[22] = " El dispositivo se ha enchufado a una fuente de alimentación, no a un anfitrión USB.\nEl dispositivo se apagará en 90 segundos.",
+	[23] = " El dispositivo se ha enchufado a una fuente de alimentación, no a un anfitrión USB.\nAhora KOReader se reiniciará…",
+	[24] = " El dispositivo se ha enchufado a una fuente de alimentación, no a un anfitrión USB.\nEl dispositivo se apagará en 90 segundos.",
+	[25] = " El dispositivo se apagará en 90 segundos.",
+	[26] = " La utilidad «fuser» ha fallado.",
+};
+
+static const char* const tr_et[TR_COUNT] = {
+	[3] = "Käivitan USBMS-i sessiooni…",
+	[4] = "USB-massmälu",
+	[11] = " KOReader käivitub nüüd uuesti…",
+	[17] = " Palun lülita USBNet käsitsi välja!\nVäljumiseks vajuta toitenuppu.",
+	[18] = " Palun lülita USBSerial käsitsi välja!\nVäljumiseks vajuta toitenuppu.",
+};
+
+static const char* const tr_fa[TR_COUNT] = {
+	[0] = "تمام!\nکوریدر اکنون بازراه‌اندازی خواهد شد…",
+	[1] = "پایان جلسه USBMS…",
+	[2] = "دکمه روشن/خاموش را برای خروج فشار دهید.",
+	[3] = "شروع جلسه USBMS…",
+	[4] = "ذخیره‌سازی انبوه USB",
+	[5] = "جلسه USBMS در حال انجام است.\nلطفاً قبل از جدا کردن دستگاه، آن را به‌طور ایمن خارج کنید.",
+	[6] = "در انتظار وصل شدن…\nیا برای خروج دکمه خاموش را فشار دهید.",
+	[7] = " پس از ۳۰ ثانیه تلاش ناموفق، عملیات متوقف شد.\nکوریدر اکنون بازراه‌اندازی خواهد شد…",
+	[8] = "پس از ۳۰ ثانیه تلاش ناموفق، عملیات متوقف شد.\nدستگاه در ۹۰ ثانیه خاموش می‌شود.",
+	[9] = " پس از ۶۰ ثانیه تلاش ناموفق، عملیات متوقف شد.\nکوریدر اکنون بازراه‌اندازی خواهد شد…",
+	[10] = " پس از ۶۰ ثانیه تلاش ناموفق، عملیات متوقف شد.\nدستگاه پس از ۹۰ ثانیه خاموش خواهد شد.",
+	[11] = " کوریدر اکنون بازراه‌اندازی خواهد شد…",
+	[12] = " عدم توانایی در شناسایی رویداد جداسازی!\nدستگاه بعد از ۹۰ ثانیه خاموش خواهد شد.",
+	[13] = " عدم توانایی در پایان دادن به جلسه USBMS!\nدستگاه پس از ۹۰ ثانیه خاموش خواهد شد.",
+	[14] = " اسکریپت fuser اجرا نشد!",
+	[15] = " عدم توانایی در شروع جلسه USBMS!\nدستگاه پس از ۹۰ ثانیه خاموش خواهد شد.",
+	[16] = "فایل سیستم مشغول است! فرایند‌های به مشکل خورده‌:",
+	[17] = " لطفا USBNet را به صورت دستی غیرفعال کنید!\nبرای خروج دکمه روشن خاموش را فشار دهید.",
+	[18] = " لطفا USBSerial را به صورت دستی غیرفعال کنید!\nبرای خروج دکمه روشن/خاموش را فشار دهید.",
+	[19] = " لطفا USBNet را به صورت دستی غیرفعال کنید!\nبرای خروج دکمه روشن/خاموش را فشار دهید.",
+	[20] = "لطفاً دستگاه را از PowerCover خارج کنید!\nبرای خروج، دکمه پاور را فشار دهید.",
+	[21] = " دستگاه به یک منبع برق معمولی وصل شده است، نه یک میزبان USB!\nکوریدر اکنون راه اندازی مجدد می‌شود…",
+	[23] = " دستگاه به یک منبع برق معمولی وصل شده است، نه یک میزبان USB!\nکوریدر اکنون راه اندازی مجدد می‌شود…",
+	[26] = " اسکریپت fuser ناموفق بود!",
+};
+
+static const char* const tr_fi[TR_COUNT] = {
+	[0] = "Valmis!\nKOReader käynnistyy nyt uudelleen…",
+	[1] = "Lopetetaan USBMS-istunto…",
+	[2] = "Poistu painamalla virtapainiketta.",
+	[3] = "Aloitetaan USBMS-istunto…",
+	[4] = "USB-massamuisti",
+	[5] = "USBMS-istunto käynnissä.\nPoista laite turvallisesti ennen kuin irrotat sen johdosta.",
+	[6] = "Odotetaan kytkentää...\nVoit myös poistua painamalla virtapainiketta.",
+	[7] = " Luovutettiin 30 sekunnin kuluttua.\nKOReader käynnistyy nyt uudelleen…",
+	[8] = " Luovutettiin 30 sekunnin kuluttua.\nLaite sammuu 90 sekunnissa.",
+	[9] = " Luovutettiin 60 sekunnin kuluttua.\nKOReader käynnistyy nyt uudelleen…",
+	[10] = " Luovutettiin 60 sekunnin kuluttua.\nLaite sammuu 90 sekunnissa.",
+	[11] = " KOReader käynnistyy nyt uudelleen…",
+	[12] = " Irrotustapahtumaa ei havaittu!\nLaite sammuu 90 sekunnissa.",
+	[13] = " USBMS-istuntoa ei voitu lopettaa!\nLaite sammuu 90 sekunnissa.",
+	[14] = " Fuser-skriptiä ei voitu suorittaa!",
+	[15] = " USBMS-istuntoa ei voitu aloittaa!\nLaite sammuu 90 sekunnissa.",
+	[16] = " Tiedostojärjestelmä on varattu! Häiritsevät prosessit:",
+	[17] = " Poista USBNet käytöstä manuaalisesti!\nPoistu painamalla virtapainiketta.",
+	[18] = " Poista USBSerial käytöstä manuaalisesti!\nPoistu painamalla virtapainiketta.",
+	[19] = " Poista mukautettu USB-gadget käytöstä manuaalisesti!\nPoistu painamalla virtapainiketta.",
+	[20] = " Ota laite pois PowerCoverista!\nPoistu painamalla virtapainiketta.",
+	[21] = " Laite on kytketty tavalliseen virtalähteeseen, ei USB-isäntään!\nKOReader käynnistyy nyt uudelleen…",
+	[22] = " Laite on kytketty tavalliseen virtalähteeseen, ei USB-isäntään!\nLaite sammuu 90 sekunnissa.",
+	[23] = " Laite kytkettiin tavalliseen virtalähteeseen, ei USB-isäntään!\nKOReader käynnistyy nyt uudelleen…",
+	[24] = " Laite kytkettiin tavalliseen virtalähteeseen, ei USB-isäntään!\nLaite sammuu 90 sekunnissa.",
+	[25] = " Laite sammuu 90 sekunnin kuluttua.",
+	[26] = " Fuser-skripti epäonnistui!",
+};
+
+static const char* const tr_fr[TR_COUNT] = {
+	[0] = "Terminé !\nKOReader va redémarrer…",
+	[1] = "Clôture de la session USBMS…",
+	[2] = "Appuyer sur le bouton d'alimentation pour quitter.",
+	[3] = "Lancement de la session USBMS…",
+	[4] = "Stockage de masse USB",
+	[5] = "Session USBMS en cours.\nMerci d'éjecter votre appareil proprement avant de le débrancher.",
+	[6] = "En attente de connexion…\nOu appuyer sur le bouton d'alimentation pour quitter.",
+	[7] = " 30 s se sont écoulées, abandon.\nKOReader va redémarrer…",
+	[8] = " 30 s se sont écoulées, abandon.\nL'appareil va s'éteindre dans 90 s.",
+	[9] = " 60 s se sont écoulées, abandon.\nKOReader va redémarrer…",
+	[10] = " 60 s se sont écoulés, abandon.\nL'appareil va s'éteindre dans 90 s.",
+	[11] = " KOReader va redémarrer…",
+	[12] = " Échec de la détection du débranchement !\nL'appareil va s'éteindre dans 90 s.",
+	[13] = " Échec de la clôture de session USBMS !\nL'appareil va s'éteindre dans 90 s.",
+	[14] = " Impossible de lancer le script fuser !",
+	[15] = " Échec du lancement de la session USBMS !\nL'appareil va s'éteindre dans 90 s.",
+	[16] = " Le système de fichier est occupé ! Processus responsables :",
+	[17] = " Merci de désactiver USBNet manuellement !\nAppuyer sur le bouton d'alimentation pour quitter.",
+	[18] = " Merci de désactiver USBSerial manuellement !\nAppuyer sur le bouton d'alimentation pour quitter.",
+	[19] = " Merci de désactiver votre gadget USB non-standard manuellement !\nAppuyer sur le bouton d'alimentation pour quitter.",
+	[20] = " Merci de sortir l'appareil de son étui PowerCover !\nAppuyer sur le bouton d'alimentation pour quitter.",
+	[21] = " L'appareil est branché à une simple source de courant, et non un hôte USB !\nKOReader va redémarrer…",
+	[22] = " L'appareil est branché à une simple source de courant, et non un hôte USB !\nL'appareil va s'éteindre dans 90 s.",
+	[23] = " L'appareil a été branché à une simple source de courant, et non un hôte USB !\nKOReader va redémarrer…",
+	[24] = " L'appareil a été branché à une simple source de courant, et non un hôte USB !\nL'appareil va s'éteindre dans 90 s.",
+	[25] = " L'appareil va s'éteindre dans 90 s.",
+	[26] = " Le script fuser a échoué !",
+};
+
+static const char* const tr_ga[TR_COUNT] = {
+	[0] = "Déanta!\nAtosóidh KOReader anois…",
+	[1] = "Ag críochnú seisiún USBMS…",
+	[2] = "Brúigh an cnaipe cumhachta le scoir.",
+	[3] = "Ag tosú seisiún USBMS…",
+	[4] = "Stóráil Mais USB",
+	[5] = "Seisiún USBMS ar siúl.\nDíphlugáil do ghléas go sábháilte sula ndíphlugálann tú é.",
+	[6] = "Ag fanacht le bheith plugáilte isteach…\nNó, brúigh an cnaipe cumhachta le scoir.",
+	[7] = " Thug sé suas tar éis 30 soicind.\nAtosóidh KOReader anois…",
+	[8] = " Thug sé suas tar éis 30 soicind.\nMúchfaidh an gléas síos i gceann 90 soicind.",
+	[9] = " Thug sé suas tar éis 60 soicind.\nAtosóidh KOReader anois…",
+	[10] = " Thug sé suas tar éis 60 soicind.\nMúchfaidh an gléas síos i gceann 90 soicind.",
+	[11] = " Atosóidh KOReader anois…",
+	[12] = " Níorbh fhéidir teagmhas díphlugála a bhrath!\nMúchfaidh an gléas síos i gceann 90 soicind.",
+	[13] = " Níorbh fhéidir deireadh a chur leis an seisiún USBMS!\nMúchfaidh an gléas síos i gceann 90 soicind.",
+	[14] = " Níorbh fhéidir an script fuser a rith!",
+	[15] = " Níorbh fhéidir an seisiún USBMS a thosú!\nMúchfaidh an gléas síos i gceann 90 soicind.",
+	[16] = " Tá an córas comhad gnóthach! Próisis chiontacha:",
+	[17] = " Díchumasaigh USBNet de láimh le do thoil!\nBrúigh an cnaipe cumhachta chun imeacht.",
+	[18] = " Díchumasaigh USBSerial de láimh le do thoil!\nBrúigh an cnaipe cumhachta chun imeacht.",
+	[19] = " Díchumasaigh do ghléas USB saincheaptha de láimh!\nBrúigh an cnaipe cumhachta le scoir.",
+	[20] = " Bain an gléas as an PowerCover le do thoil!\nBrúigh an cnaipe cumhachta le scoir.",
+	[21] = " Tá an gléas plugáilte isteach i bhfoinse cumhachta simplí, ní i óstach USB!\nAtosóidh KOReader anois…",
+	[22] = " Tá an gléas plugáilte isteach i bhfoinse cumhachta simplí, ní i óstach USB!\nMúchfaidh an gléas síos i gceann 90 soicind.",
+	[23] = " Bhí an gléas plugáilte isteach i bhfoinse cumhachta simplí, ní i óstach USB!\nAtosóidh KOReader anois…",
+	[24] = " Bhí an gléas plugáilte isteach i bhfoinse cumhachta simplí, ní i óstach USB!\nMúchfaidh an gléas síos i gceann 90 soicind.",
+	[25] = " Múchfaidh an gléas síos i gceann 90 soicind.",
+	[26] = " Theip ar an script comhleáithe!",
+};
+
+static const char* const tr_gl[TR_COUNT] = {
+	[0] = "Feito!\nKOReader vaise reiniciar agora…",
+	[1] = "A finalizar a sesión USBMS…",
+	[2] = "Preme o botón de acendido para saír.",
+	[3] = "A comezar a sesión USBMS…",
+	[4] = "Almacenamento masivo USB",
+	[5] = "Sesión USBMS en curso.\nPor favor expulsa o dispositivo de xeito seguro antes de desconectalo.",
+	[6] = "Agardando pola conexión...\nOu preme o botón de acendido para saír.",
+	[7] = " Pasaron 30 segundos sen conexión, abandonar.\nKOReader vaise reiniciar agora…",
+	[8] = " Pasaron 30 segundos sen conexión, abandonar.\nO dispositivo apagarase en 90 segundos.",
+	[9] = " Pasaron 60 segundos sen conexión, abandonar.\nKOReader vaise reiniciar agora…",
+	[10] = " Pasaron 60 segundos sen conexión, abandonar.\nO dispositivo apagarase en 90 segundos.",
+	[11] = " KOReader vai reiniciar agora…",
+	[12] = " Non se detectou un evento de desconexión!\nO dispositivo apagarase en 90 segundos.",
+	[13] = " Non se puido finalizar a sesión USBMS!\nO dispositivo apagarase en 90 segundos.",
+	[14] = " Non se puido executar o script fuser!",
+	[15] = " Non se puido comezar a sesión USBMS!\nO dispositivo apagarase en 90 segundos.",
+	[16] = " O sistema de ficheiros está en uso! Procesos culpables:",
+	[17] = " Por favor desactiva USBNet manualmente!\nPreme o botón de acendido para saír.",
+	[18] = " Por favor desactiva USBSerial manualmente!\nPreme o botón de acendido para saír.",
+	[19] = " Por favor desactiva USB gadget manualmente!\nPreme o botón de acendido para saír.",
+	[20] = " Por favor extrae o dispositivo da funda PowerCover!\nPreme o botón de acendido para saír.",
+	[21] = " O dispositivo conectouse a unha fonte de alimentación, non a un host USB!\nKOReader vaise reiniciar agora…",
+	[22] = " O dispositivo conectouse a unha fonte de alimentación, non a un host USB!\nO dispositivo apagarase en 90 segundos.",
+	[23] = " O dispositivo conectouse a unha fonte de alimentación, non a un host USB!\nKOReader vaise reiniciar agora…",
+	[24] = " O dispositivo conectouse a unha fonte de alimentación, non a un host USB!\nO dispositivo apagarase en 90 segundos.",
+	[25] = " O dispositivo apagarase en 90 segundos.",
+	[26] = " Fallou o script fuser!",
+};
+
+static const char* const tr_he[TR_COUNT] = {
+	[0] = "בוצע!\nכעת KOReader יופעל מחדש…",
+	[1] = "מסיים הפעלת USBMS…",
+	[2] = "לחץ על לחצן ההפעלה כדי לצאת.",
+	[3] = "מתחיל הפעלת USBMS…",
+	[4] = "אחסון בנפח על USB",
+	[5] = "הפעלת USBMS בעיצומה.\nאנא הוצא את המכשיר שלך בבטחה לפני שתנתק אותו.",
+	[6] = "ממתין להיות מחובר…\nלחלופין, לחץ על לחצן ההפעלה כדי לצאת.",
+	[7] = " ויתרתי אחרי 30 שניות.\nKOReader יופעל מחדש כעת …",
+	[8] = " ויתרתי אחרי 30 שניות.\nההתקן יכבה בעוד 90 שניות.",
+	[9] = " ויתרתי אחרי 60 שניות.\nKOReader יופעל מחדש כעת…",
+	[10] = " ויתרתי אחרי 60 שניות.\nההתקן יכבה בעוד 90 שניות.",
+	[11] = "‪KOReader ‬ יופעל מחדש …",
+	[12] = " לא ניתן לאתר אירוע ניתוק!\nהמכשיר יכבה בעוד 90 שניות.",
+	[13] = " לא ניתן לסיים את הפעלת USBMS!\nהמכשיר יכבה בעוד 90 שניות.",
+	[14] = " לא ניתן להריץ סקריפט fuser!",
+	[15] = " לא ניתן להפעיל את USBMS!\nהמכשיר יכבה בעוד 90 שניות.",
+	[16] = " מערכת הקבצים תפוסה! תהליכים פוגעניים:",
+	[17] = " השבת USBNet באופן ידני!\nלחץ על לחצן ההפעלה כדי לצאת.",
+	[18] = " השבת USBSerial באופן ידני!\nלחץ על לחצן ההפעלה כדי לצאת.",
+	[19] = " נא להשבית את חפיץ ה־USB ידנית!\nלחיצה על לחצן הכיבוי תסיים.",
+	[20] = " נא להוציא את המכשיר מה־PowerCover (כיסוי חכם)!\nיש ללחוץ על לחצן ההפעלה כדי לצאת.",
+	[21] = " המכשיר מחובר למקור חשמל רגיל ולא למארח USB!\nהמכשיר יופעל מחדש כעת…",
+	[22] = " המכשיר מחובר למקור חשמל רגיל ולא למארח USB!\nהמכשיר יכבה בעוד 90 שניות.",
+	[23] = " המכשיר היה מחובר למקור חשמל רגיל ולא למארח USB!\nהמכשיר יופעל מחדש בעוד 30 שניות…",
+	[24] = " המכשיר היה מחובר למקור חשמל רגיל ולא למארח USB!\nהמכשיר יכבה בעוד 90 שניות.",
+	[25] = " המכשיר יכבה בעוד 90 שניות.",
+	[26] = " סקריפט ה-fuser נכשל!",
+};
+
+static const char* const tr_hi[TR_COUNT] = {
+	[2] = "छोड़ने के लिए पावर बटन दबाएं।",
+	[4] = "USB विपुल भंडारण",
+	[7] = " ३० सेकंड के बाद छोड़ दिया।\nकोरीडर अभी पुनर्प्रारंभ करेगा…",
+	[11] = " कोरीडर अभी पुनर्प्रारंभ करेगा…",
+	[17] = "कृपया USBNet को मैन्युअली अक्षम करें!\nबाहर निकलने के लिए पावर बटन दबाएँ।",
+};
+
+static const char* const tr_hr[TR_COUNT] = {
+	[0] = "Gotovo!\nKOReader će se sada ponovo pokrenuti …",
+	[1] = "Završavanje USBMS sesije …",
+	[2] = "Pritisni gumb za uključivanje/isključivanje za izlaz.",
+	[3] = "Pokretanje USBMS sesije …",
+	[4] = "USB memorija",
+	[5] = "USBMS sesija je u tijeku.\nIzbaci uređaj prije nego što ga odspojiš.",
+	[6] = "Čeka se na priključivanje …\nIli pritisni gumb za uključivanje/isključivanje za izlaz.",
+	[7] = " Odustaje se nakon 30 s.\nKOReader će se sada ponovo pokrenuti …",
+	[8] = " Odustaje se nakon 30 s.\nUređaj će se isključiti za 90 s.",
+	[9] = " Odustaje se nakon 60 s.\nKOReader će se sada ponovo pokrenuti …",
+	[10] = " Odustaje se nakon 60 s.\nUređaj će se isključiti za 90 s.",
+	[11] = " KOReader će se sada ponovo pokrenuti …",
+	[12] = " Nije bilo moguće otkriti odagađaj odspajanja uređaja!\nUređaj će se isključiti za 90 s.",
+	[13] = " Nije bilo moguće završiti USBMS sesiju!\nUređaj će se isključiti za 90 s.",
+	[14] = " Nije bilo moguće pokrenuti skripta programa fuser!",
+	[15] = " Nije bilo moguće pokrenuti USBMA sesiju!\nUređaj će se isključiti za 90 s.",
+	[16] = " Datotečni sustav je zauzet! Krivi procesi:",
+	[17] = " Deaktiviraj USBNet ručno!\nPritisni gumb za uključivanje/isključivanje za izlaz.",
+	[18] = " Deaktiviraj USBSerial ručno!\nPritisni gumb za uključivanje/isključivanje za izlaz.",
+	[19] = " Deaktiviraj tvoj prilagođeni USB uređaj ručno!\nPritisni gumb za uključivanje/isključivanje za izlaz.",
+	[20] = " Ukloni uređaj iz PowerCovera!\nPritisni gumb za uključivanje/isključivanje za izlaz.",
+	[21] = " Uređaj je priključen na običan izvor napajanja, a ne na USB host!\nKOReader će se sada ponovo pokrenuti …",
+	[22] = " Uređaj je priključen na običan izvor napajanja, a ne na USB host!\nUređaj će se isključiti za 90 sekundi.",
+	[23] = " Uređaj je bio priključen na običan izvor napajanja, a ne na USB host!\nKOReader će se sada ponovo pokrenuti …",
+	[24] = " Uređaj je bio priključen na običan izvor napajanja, a ne na USB host!\nUređaj će se isključiti za 90 sekundi.",
+	[25] = " Uređaj će se isključiti za 90 s.",
+	[26] = " Skripta programa fuser neuspjela!",
+};
+
+static const char* const tr_hu[TR_COUNT] = {
+	[0] = "Kész!\nA KOReader újraindul…",
+	[1] = "USBMS üzemmód befejezése…",
+	[2] = "Kilépéshez nyomja meg a Power gombot.",
+	[3] = "USBMS üzemmód indítása…",
+	[4] = "USB tárhely üzemmód",
+	[5] = "USBMS üzemmód.\nBiztonságosan távolítsa el az eszközt, mielőtt leválasztaná.",
+	[6] = "Várakozás a csatlakoztatásra…\nVagy, kilépéshez nyomja meg a Power gombot.",
+	[7] = " 30 mp múlva megszakítás.\nA KOReader újraindul…",
+	[8] = " 30 mp múlva megszakítás.\nAz eszköz 90 mp-en belül kikapcsol.",
+	[9] = " 60 mp múlva megszakítás.\nA KOReader újraindul…",
+	[10] = " 60 mp múlva megszakítás.\nAz eszköz 90 mp-en belül kikapcsol.",
+	[11] = " A KOReader újraindul…",
+	[12] = " Nem érzékelt lecsatlakoztatási esemény!\nAz eszköz 90mp múlva leáll.",
+	[13] = " Hiba USBMS mód befejezése közben!\nAz eszköz 90mp múlva leáll.",
+	[14] = " Az fuser szkript nem futtatható!",
+	[15] = " Az USBMS üzemmód indítása sikertelen!\nAz eszköz 90mp múlva kikapcsol.",
+	[16] = " A fájlrendszer foglalt! Kapcsolódó folyamatok:",
+	[17] = " Kapcsolja ki az USBNet funkciót!!\nKilépéshez nyomja meg a Power gombot.",
+	[18] = " Kapcsolja ki az USBSerial funkciót!\nKilépéshez nyomja meg a Power gombot.",
+	[19] = " Manuálisan tiltsa le az egyéni USB-eszközét!\nKilépéshez nyomja meg a bekapcsológombot.",
+	[20] = " Vegye ki a készüléket a PowerCoverből! \nKilépéshez nyomja meg a Power gombot.",
+	[21] = " A készülék egy sima áramforráshoz csatlakozott, nem egy USB hosthoz!\nA KOReader újraindul…",
+	[22] = " A készülék egy sima áramforráshoz csatlakozott, nem egy USB hosthoz!\nA készülék 90 mp-en belül leáll.",
+	[23] = " A készülék egy sima áramforráshoz csatlakozott, nem egy USB hosthoz!\nA KOReader újraindul…",
+	[24] = " A készülék egy sima áramforráshoz csatlakozott, nem egy USB hosthoz!\nA készülék 90 mp-en belül leáll.",
+	[25] = " Az eszköz 90 mp múlva kikapcsol.",
+	[26] = " Az fuser szkript hibára futott!",
+};
+
+static const char* const tr_id[TR_COUNT] = {
+	[0] = "Selesai!\nKOReader akan restart sekarang…",
+	[1] = "Mengakhiri sesi USBMS…",
+	[2] = "Tekan tombol power untuk keluar.",
+	[3] = "Memulai sesi USBMS…",
+	[4] = "Penyimpanan USB",
+	[5] = "Sesi USBMS sedang berlangsung.\nHarap lepaskan perangkat Anda dengan aman sebelum mencabutnya.",
+	[6] = "Menunggu tersambung…\nAtau tekan tombol power untuk keluar.",
+	[7] = " Batal setelah 30 detik.\nKOReader akan restart sekarang…",
+	[8] = " Gagal setelah 30 detik.\nPerangkat akan mati dalam 90 detik.",
+	[9] = " Gagal setelah 60 detik.\nKOReader akan restart sekarang…",
+	[10] = " Gagal setelah 60 detik.\nPerangkat akan mati dalam 90 detik.",
+	[11] = " KOReader akan nyala ulang…",
+	[12] = " Peristiwa pencabutan tidak terdeteksi!\nPerangkat akan mati dalam 90 detik.",
+	[13] = " Tidak dapat mengakhiri sesi USBMS!\nPerangkat akan mati dalam 90 detik.",
+	[14] = " Tidak bisa menjalankan fuser script!",
+	[15] = " Tidak bisa memulai sesi USBMS!\nPerangkat akan mati dalam 90 detik.",
+	[16] = " Filesystem sibuk! Proses penyebab:",
+	[17] = " Nonaktifkan USBNet secara manual!\nTekan tombol power untuk keluar.",
+	[18] = " Nonaktifkan USBSerial secara manual!\nTekan tombol power untuk keluar.",
+	[19] = " Nonaktifkan gawai USB custom Anda secara manual!\nTekan tombol power untuk keluar.",
+	[20] = " Lepas gawai dari PowerCover!\nTekan tombol power untuk keluar.",
+	[21] = " Perangkat tersambung ke pengisi daya, bukan ke USB host!\nPerangkat akan restart sekarang…",
+	[22] = " Perangkat tersambung ke pengisi daya, bukan ke USB host!\nPerangkat akan mati dalam 90 detik.",
+	[23] = " Perangkat tersambung ke pengisi daya, bukan ke USB host!\nKOReader akan menyala ulang…",
+	[24] = " Perangkat tersambung ke pengisi daya, bukan ke USB host!\nPerangkat akan mati dalam 90 detik.",
+	[25] = " Perangkat akan mati dalam 90 detik.",
+	[26] = " Fuser script gagal!",
+};
+
+static const char* const tr_it[TR_COUNT] = {
+	[0] = "Fatto!\nKOReader ora verrà riavviato…",
+	[1] = "Chiusura della sessione USBMS in corso…",
+	[2] = "Premi il pulsante di accensione per uscire.",
+	[3] = "Avvio sessione USBMS…",
+	[4] = "Memoria di massa USB",
+	[5] = "Sessione USBMS in corso.\nEspelli il dispositivo in modo sicuro prima di scollegarlo.",
+	[6] = "In attesa di essere collegato...\nIn alternativa, premi il pulsante di alimentazione per uscire.",
+	[7] = " Nessun risultato dopo 30 secondi.\nKOReader verrà riavviato ora…",
+	[8] = " Nessun risultato dopo 30 secondi.\nIl dispositivo si spegnerà tra 90 secondi.",
+	[9] = " Nessun risultato dopo 60 sec.\nKOReader verrà riavviato ora…",
+	[10] = " Nessun risultato dopo 60 secondi.\nIl dispositivo si spegnerà tra 90 secondi.",
+	[11] = " KOReader verrà riavviato…",
+	[12] = " Impossibile rilevare l'evento di scollegamento!\nIl dispositivo si spegnerà entro 90 secondi.",
+	[13] = " Impossibile terminare la sessione USBMS!\nIl dispositivo si spegnerà entro 90 secondi.",
+	[14] = " Impossibile eseguire lo script di unione!",
+	[15] = " Impossibile avviare la sessione USBMS!\nIl dispositivo si spegnerà entro 90 secondi.",
+	[16] = " Il file system è occupato! Processi che interferiscono:",
+	[17] = " Disattiva manualmente USBNet!\nPremi il pulsante di accensione per uscire.",
+	[18] = " Disattiva manualmente USBSerial!\nPremi il pulsante di accensione per uscire.",
+	[19] = " Disattiva manualmente il tuo gadget USB personalizzato!\nPremi il pulsante di accensione per uscire.",
+	[20] = " Togli il dispositivo dalla PowerCover!\nPremi il pulsante di accensione per uscire.",
+	[21] = " Il dispositivo è collegato a un normale alimentatore, non a un host USB!\nKOReader verrà riavviato ora…",
+	[22] = " Il dispositivo è collegato a un normale alimentatore, non a un host USB!\nIl dispositivo si spegnerà tra 90 secondi.",
+	[23] = " Il dispositivo è stato collegato a una normale fonte di alimentazione, non a un host USB!\nKOReader verrà riavviato ora…",
+	[24] = " Il dispositivo è stato collegato a una normale fonte di alimentazione, non a un host USB!\nIl dispositivo si spegnerà tra 90 secondi.",
+	[25] = " Il dispositivo si spegnerà in 90 secondi.",
+	[26] = " Lo script fusore è fallito!",
+};
+
+static const char* const tr_kab[TR_COUNT] = {
+	[3] = "Asekker n tɣimit n USBMS…",
+};
+
+static const char* const tr_ko[TR_COUNT] = {
+	[0] = "완료!\nKOReader가 지금 다시 시작됩니다…",
+	[1] = "USBMS 세션 마치는 중…",
+	[2] = "끝내려면 전원 버튼을 누르세요.",
+	[3] = "USBMS 세션 시작 중…",
+	[4] = "USB 대용량 저장 장치",
+	[5] = "USBMS 세션이 진행 중입니다.\n장치를 안전하게 꺼내기를 한 후에 플러그를 뽑으세요.",
+	[6] = "연결 대기 중…\n또는 끝내려면 전원 버튼을 누르세요.",
+	[7] = " 30초 후 포기.\nKOReader가 지금 다시 시작됩니다…",
+	[8] = " 30초 후에 그만둡니다.\n장치가 90초 후에 시스템 종료됩니다.",
+	[9] = " 60초 후 포기.\nKOReader가 지금 다시 시작됩니다…",
+	[10] = " 60초 후에 그만둡니다.\n장치가 90초 후에 시스템 종료됩니다.",
+	[11] = " KOReader가 지금 다시 시작됩니다…",
+	[12] = " 플러그 분리 이벤트를 감지하지 못했습니다!\n장치가 90초 후에 시스템 종료됩니다.",
+	[13] = " USBMS 세션을 끝낼 수 없습니다!\n장치가 90초 후에 시스템 종료됩니다.",
+	[14] = " 퓨저 스크립트를 실행할 수 없습니다!",
+	[15] = " USBMS 세션을 시작할 수 없습니다!\n이 장치가 90초 후에 시스템 종료됩니다.",
+	[16] = " 파일 시스템이 사용 중입니다! 위반 프로세스:",
+	[17] = " USBNet을 수동으로 비활성화하세요!\n끝내려면 전원 버튼을 누르십시오.",
+	[18] = " USBSerial을 수동으로 비활성화하세요!\n끝내려면 전원 버튼을 누르십시오.",
+	[19] = " 사용자 지정 USB 가젯을 수동으로 비활성화하세요!\n끝내려면 전원 버튼을 누르세요.",
+	[20] = " PowerCover에서 장치를 꺼내십시오!\n종료하려면 전원 버튼을 누르십시오.",
+	[21] = " 장치가 USB 호스트가 아닌 일반 전원에 연결되어 있습니다!\nKOReader가 지금 다시 시작됩니다…",
+	[22] = " 장치가 USB 호스트가 아닌 일반 전원에 연결되어 있습니다!\n장치가 90초 후에 시스템 종료됩니다.",
+	[23] = " 장치가 USB 호스트가 아닌 일반 전원에 연결되었습니다!\nKOReader가 지금 다시 시작됩니다…",
+	[24] = " 장치가 USB 호스트가 아닌 일반 전원에 연결되었습니다!\n장치가 90초 후에 시스템 종료됩니다.",
+	[25] = " 장치가 90초 후에 시스템 종료됩니다.",
+	[26] = " 퓨저 스크립트가 실패했습니다!",
+};
+
+static const char* const tr_lt[TR_COUNT] = {
+	[0] = "Atlikta!\nKOReader dabar bus paleistas iš naujo…",
+	[1] = "Baigiama USBMS sesija…",
+	[2] = "Norėdami išeiti, paspauskite įrenginio išjungimo mygtuką.",
+	[3] = "Pradedama USBMS sesija…",
+	[4] = "USMB masinė saugykla",
+	[5] = "Vykdoma USBMS sesija.\nPrieš atjungdami, pasirinkite saugų įrenginio atjungimą.",
+	[6] = "Laukiama kada bus prijungta USB jungtis…\nArba paspauskite įrenginio išjungimo mygtuką, kad išeitumėte.",
+	[7] = " Bandyta 30 sek., veiksmas nepavyko.\nKOReader bus paleistas iš naujo…",
+	[8] = "Bandyta 30 sek., veiksmas nepavyko.\nĮrenginys išsijungs po 90 sek.",
+	[9] = " Bandyta 60 sek., veiksmas nepavyko.\nKOReader bus paleistas iš naujo…",
+	[10] = " Bandyta 60 sek., veiksmas nepavyko.\nĮrenginys išsijungs po 90 sek.",
+	[11] = " KOReader bus paleistas iš naujo…",
+	[12] = " Nepavyko aptikti atjungimo įvykio!\nĮrenginys išsijungs po 90 sek.",
+	[13] = " Nepavyko užbaigti USBMS sesijos!\nĮrenginys išsijungs po 90 sek.",
+	[14] = " Nepavyko paleisti fuser scenarijaus!",
+	[15] = " Nepavyko paleisti USBMS sesijos!\nĮrenginys išsijungs po 90 sek.",
+	[16] = " Failų sistema užimta! Pažeidžiantys procesai:",
+	[17] = " Išjunkite USBSerial rankiniu būdu!\nNorėdami išeiti, paspauskite įrenginio išjungimo mygtuką.",
+	[18] = " Išjunkite USBSerial rankiniu būdu!\nNorėdami išeiti, paspauskite įrenginio išjungimo mygtuką.",
+	[19] = " Išjunkite USBSerial rankiniu būdu!\nNorėdami išeiti, paspauskite įrenginio išjungimo mygtuką.",
+	[20] = " Išimkite įrenginį iš PowerCover!\nNorėdami išeiti, paspauskite maitinimo mygtuką.",
+	[21] = " Įrenginys prijungtas prie paprasto maitinimo šaltinio, o ne USB duomenų šaltinio!\nKOReader dabar bus paleistas iš naujo…",
+	[22] = " Įrenginys prijungtas prie paprasto maitinimo šaltinio, o ne USB duomenų šaltinio!\nĮrenginys išsijungs po 90 sek.",
+	[23] = " Įrenginys prijungtas prie paprasto maitinimo šaltinio, o ne USB duomenų šaltinio!\nKOReader bus paleistas iš naujo…",
+	[24] = " Įrenginys prijungtas prie paprasto maitinimo šaltinio, o ne USB duomenų šaltinio!\nĮrenginys išsijungs po 90 sek.",
+	[25] = " Įrenginys išsijungs po 90 sek.",
+	[26] = " Kaitintuvo scenarijaus nepavyko!",
+};
+
+static const char* const tr_lv[TR_COUNT] = {
+	[0] = "Pabeigts!\nKOReader tagad restartēsies…",
+	[1] = "Beidzam USBMS sesiju…",
+	[2] = "Spiediet ieslēgšanas pogu lai izietu.",
+	[3] = "Sākam USBMS sesiju…",
+	[4] = "USB lielapjoma atmiņa",
+	[5] = "Šobrīd notiek USBMS sesija.\nLūdzu droši atvienojiet ierīci pirms izraujat no vada.",
+	[6] = "Gaidu, kad tiks izveidots USB savienojums...\nVai spiediet ieslēgšanas pogu lai izietu.",
+	[7] = " Padevos pēc 30 sekundēm.\nKOReader tiks restartēts tagad…",
+	[8] = " Padevos pēc 30 sekundēm.\nIerīce tiks izslēgta pēc 90 sekundēm.",
+	[9] = " Padevos pēc 60 sekundēm.\nKOReader tiks restartēts tagad…",
+	[10] = " Padevos pēc 60 sekundēm.\nIerīce izslēgsies pēc 90 sekundēm.",
+	[11] = " KOReader tiks restartēts…",
+	[12] = " Nevarējām noteikt, vai ierīce tika atvienota!\nIerīce izslēgsies pēc 90 sekundēm.",
+	[13] = " Neizdevās pabeigt USBMS sesiju!\nIerīce izslēgsies pēc 90 sekundēm.",
+	[14] = " Neizdevās palaist fuser skriptu!",
+	[15] = " Neizdevās uzsākt USBMS sesiju!\nIerīce izslēgsies pēc 90 sekundēm.",
+	[16] = " Failu sistēma ir aizņemta! Bloķējošie procesi:",
+	[17] = " Lūdzu atslēdziet USBNet manuāli!\nSpiediet ieslēgšanas pogu lai izietu.",
+	[18] = " Lūdzu atslēdziet USBSerial manuāli!\nSpiediet ieslēgšanas pogu lai izietu.",
+	[20] = " Lūdzu, izņemiet ierīci no PowerCover vāciņa!\nSpiediet ieslēgšanas pogu, lai izietu.",
+	[21] = " Ierīce tika pievienota enerģijas avotam nevis USB saimniekdatoram!\nKOReader tagad restartēsies…",
+	[22] = " Ierīce tika pievienota enerģijas avotam nevis USB saimniekdatoram!\nIerīce izslēgsies pēc 90 sekundēm.",
+	[23] = " Ierīce tika pievienota enerģijas avotam nevis USB saimniekdatoram!\nKOReader tagad restartēsies…",
+	[24] = " Ierīce tika pievienota enerģijas avotam nevis USB saimniekdatoram!\nIerīce izslēgsies pēc 90 sekundēm.",
+	[25] = " Ierīce tiks izslēgta pēc 90 sekundēm.",
+	[26] = " fuser skripts bija nesekmīgs!",
+};
+
+static const char* const tr_nb_NO[TR_COUNT] = {
+	[0] = "Ferdig.\nKOReader vil nå starte på ny …",
+	[1] = "Sluttfører USBMS-økt …",
+	[2] = "Trykk på av/på-knappen for å avslutte.",
+	[3] = "Starter USBMS-økt …",
+	[4] = "USB-masselagringsenhet",
+	[5] = "USBMS-økt underveis.\nLøs ut enheten trygt før du plugger den ut.",
+	[6] = "Venter på å bli plugget inn …\nEller, trykk av/på-knappen for å avslutte.",
+	[7] = " Ga opp etter 30 sek.\nKOReader vil nå starte på ny …",
+	[8] = " Ga opp etter 30 sek.\nEnheten vil slås av om 90 sek.",
+	[9] = " Ga opp etter 60 sek.\nKOReader vil nå starte på nytt …",
+	[10] = " Ga opp etter 60 sek.\nEnheten vil slås av om 90 sek.",
+	[11] = " KOReader vil nå starte på ny …",
+	[12] = " Klarte ikke å oppdage utpluggingshendelse.\nEnheten vil slås av om 90 sek.",
+	[13] = " Klarte ikke å sluttføre USBMS-økt!\nEnheten vil slås av om 90 sek.",
+	[14] = " Klarte ikke å kjøre fuser-skriptet!",
+	[15] = " Klarte ikke å starte USBMS-økten.\nEnheten vil slås av om 90 sek.",
+	[16] = " Filsystemet er opptatt. Disse prosessene krangler:",
+	[17] = " Skru av USBNet manuelt.\nBruk på/av-knappen for å avslutte.",
+	[18] = " Skru av USBSerial manuelt.\nBruk på/av-knappen for å avslutte.",
+	[19] = " Vennligst deaktiver den egendefinerte USB-gadgeten manuelt!\nTrykk på av/på-knappen for å avslutte.",
+	[20] = " Ta enheten ut av PowerCover!\nTrykk på av/på-knappen for å avslutte.",
+	[21] = " Enheten er nå plugget inn i en vanlig ladekilde, ikke en USB-vert.\nKOReader vil nå starte på ny …",
+	[22] = " Enheten er plugget inn i en vanlig ladekilde, ikke en USB-vert!\nEnheten vil nå slås av om 90 sek.",
+	[23] = " Enheten ble plugget inn i en vanlig ladekilde, ikke en USB-vert.\nKOReader vil nå starte på ny …",
+	[24] = " Enheten ble plugget inn i en vanlig ladekilde, ikke en USB-vert.\nEnheten vil slås av om 90 sek.",
+	[25] = " Enheten vll slås av om 90 sek.",
+	[26] = " Fuser-skriptet mislyktes!",
+};
+
+static const char* const tr_nl[TR_COUNT] = {
+	[0] = "Klaar!\nKOReader zal nu opnieuw opstarten…",
+	[1] = "Afsluiten van USBMS-sessie…",
+	[2] = "Druk op de aan/uit-knop om af te sluiten.",
+	[3] = "USBMS-sessie starten…",
+	[4] = "USB-opslag",
+	[5] = "USBMS-sessie aan de gang.\nWerp het apparaat veilig uit voordat u de kabel eruit haalt.",
+	[6] = "Wachten om te worden aangesloten…\nOf druk op de aan/uit-knop om af te sluiten.",
+	[7] = " Opgegeven na 30 seconden.\nKOReader zal nu opnieuw opstarten…",
+	[8] = " Opgegeven na 30 seconden.\nHet apparaat wordt over 90 seconden uitgeschakeld.",
+	[9] = " Opgegeven na 60 seconden.\nKOReader zal nu opnieuw opstarten…",
+	[10] = " Opgegeven na 60 seconden.\nHet apparaat wordt over 90 seconden uitgeschakeld.",
+	[11] = " KOReader zal nu opnieuw opstarten…",
+	[12] = " Loskoppeling kon niet worden gedetecteerd!\nHet apparaat zal over 90 seconden worden uitgeschakeld.",
+	[13] = " De USBMS-sessie kon niet worden beëindigd!\nHet apparaat wordt over 90 seconden uitgeschakeld.",
+	[14] = " Het fuserscript kan niet worden uitgevoerd!",
+	[15] = " De USBMS-sessie kon niet worden gestart!\nHet apparaat wordt over 90 seconden uitgeschakeld.",
+	[16] = " Bestandssysteem is bezig! Verantwoordelijke processen:",
+	[17] = " Schakel USBNet handmatig uit!\nDruk op de aan/uit-knop om af te sluiten.",
+	[18] = " Schakel USBSerial handmatig uit!\nDruk op de aan/uit-knop om af te sluiten.",
+	[19] = " Schakel het aangepaste usb-apparaat handmatig uit!\nDruk op de aan/uit-knop om af te sluiten.",
+	[20] = " Haal het apparaat uit de PowerCover!\nDruk op de aan/uit-knop om af te sluiten.",
+	[21] = " Het apparaat is op een gewone stroombron aangesloten, niet op een USB-host! \nKOReader zal nu herstarten…",
+	[22] = " Het apparaat is op een gewone stroombron aangesloten, niet op een USB-host! \nHet apparaat wordt over 90 seconden uitgeschakeld.",
+	[23] = " Het apparaat is op een gewone stroombron aangesloten, niet op een USB-host!\nKOReader zal nu herstarten…",
+	[24] = " Het apparaat is op een gewone stroombron aangesloten, niet op een USB-host!\nHet apparaat wordt over 90 seconden uitgeschakeld.",
+	[25] = " Het apparaat wordt over 90 seconden uitgeschakeld.",
+	[26] = " Het fuserscript is mislukt!",
+};
+
+static const char* const tr_nn[TR_COUNT] = {
+	[0] = "Ferdig!\nKOReader kjem no til å starta om att…",
+	[1] = "Avsluttar USBMS-økt…",
+	[2] = "Trykk på straumknappen for å avslutta.",
+	[3] = "Byrjar USBMS-økt…",
+	[4] = "USB-masselagringseining",
+	[5] = "USBMS-økt i gang.\nLøys ut eininga trygt før du koplar henne frå.",
+	[6] = "Ventar på å koplast til straum…\nEller trykk på straumknappen for å avslutta.",
+	[7] = " Gav opp etter 30 sek.\nKOReader kjem no til å starta om att…",
+	[8] = " Gav opp etter 30 sek.\nEininga kjem til å slå seg av om 90 sek.",
+	[9] = " Gav opp etter 60 sek.\nKOReader kjem no til å starta om att…",
+	[10] = " Gav opp etter 60 sek.\nEininga kjem til å slå seg av om 90 sek.",
+	[11] = " KOReader kjem no til å starta om att…",
+	[12] = " Klarte ikkje å oppdaga fråkopling!\nEininga kjem til å slå seg av om 90 sek.",
+	[13] = " Klarte ikkje å avslutta USBMS-økta!\nEininga kjem til å slå seg av om 90 sek.",
+	[14] = " Klarte ikkje å køyra fuser-skriptet!",
+	[15] = " Klarte ikkje å byrja USBMS-økta.\nEininga kjem til å slå seg av om 90 sek.",
+	[16] = " Filsystemet er oppteke. Desse prosessane er skuldige:",
+	[17] = " Skru av USBNet for hand!\nTrykk på straumknappen for å avslutta.",
+	[18] = " Slå av USBSerial for hand!\nTrykk på straumknappen for å avslutta.",
+	[19] = " Slå av din eigendefinera USB-einingsfunksjon for hand!\nTrykk på straumknappen for å avslutta.",
+	[20] = " Tak eininga or PowerCoveret!\nTrykk på straumknappen for å avslutta.",
+	[21] = " Eininga er kopla til ei vanleg straumkjelde, ikkje ein USB-vert!\nKOReader kjem no til å starta om att…",
+	[22] = " Eininga er kopla til ei vanleg straumkjelde, ikkje ein USB-vert!\nEininga kjem til å slå seg av om 90 sek.",
+	[23] = " Eininga vart kopla til ei vanleg straumkjelde, ikkje ein USB-vert!\nKOReader kjem no til å starta om att…",
+	[24] = " Eininga vart kopla til ei vanleg straumkjelde, ikkje ein USB-vert!\nEininga kjem til å slå seg av om 90 sek.",
+	[25] = " Eininga kjem til å slå seg av om 90 sek.",
+	[26] = " Fuser-skriptet mislukkast!",
+};
+
+static const char* const tr_pa_PK[TR_COUNT] = {
+	[2] = "بند کرن لئی پور بٹن چھیڑو۔",
+	[4] = "یوایس‌بی سٹوریج",
+	[14] = " مِلاوݨ والا پھلن لگ نہیں سکدا!",
+	[16] = " فائل سِسٹم رُجھیا ہویا اے! حالیہ لگدے:",
+	[17] = " یوایس‌بی نیٹ ہتھیں چالو اُلٹایو!\nبند کرن لئی پاور بٹن چھیڑو۔",
+	[18] = " یوایس‌بی سیریال ہتھیں چالو اُلٹایو!\nبند کرن لئی پاور بٹن چھیڑو۔",
+	[20] = " پاورکور توں ڈیوائس ہٹایو!\nبند کرن لئی پور بٹن چھیڑو۔",
+	[26] = " مِلاوݨ والا پھلن لگ نہیں سکدا!",
+};
+
+static const char* const tr_pl[TR_COUNT] = {
+	[0] = "Zakończono!\nKOReader się teraz zrestartuje…",
+	[1] = "Kończenie sesji USBMS…",
+	[2] = "Naciśnij przycisk zasilania, aby wyjść.",
+	[3] = "Rozpoczynanie sesji USBMS…",
+	[4] = "Pamięć masowa USB",
+	[5] = "Sesja USBMS w trakcie.\nProszę bezpiecznie usunąć urządzenie przed odpięciem.",
+	[6] = "Oczekiwanie na podłączenie...\nMożesz też nacisnąć przycisk zasilania, aby wyjść.",
+	[7] = " Zrezygnowano po 30 sek.\nKOReader uruchomi się teraz ponownie…",
+	[8] = " Zrezygnowano po 30 sekundach.\nUrządzenie wyłączy się za 90 sekund.",
+	[9] = " Zrezygnowano po 60 sekundach.\nKOReader uruchomi się teraz ponownie…",
+	[10] = " Zrezygnowano po 60 sekundach.\nUrządzenie wyłączy się za 90 sekund.",
+	[11] = " KOReader uruchomi się teraz ponownie…",
+	[12] = " Nie można wykryć odłączenia urządzenia!\nUrządzenie wyłączy się za 90 sekund.",
+	[13] = " Nie można zakończyć sesji USBMS!\nUrządzenie wyłączy się za 90 sekund.",
+	[14] = " Nie można uruchomić skryptu fuser!",
+	[15] = " Nie można rozpocząć sesji USBMS!\nUrządzenie wyłączy się za 90 sekund.",
+	[16] = " System plików jest zajęty! Proces:",
+	[17] = " Proszę wyłączyć USBNet ręcznie!\nNaciśnij przycisk zasilania, aby wyjść.",
+	[18] = " Proszę wyłączyć USBSerial ręcznie!\nNaciśnij przycisk zasilania, aby wyjść.",
+	[19] = " Proszę wyłączyć niestandardowy gadżet USB ręcznie!\nNaciśnij przycisk zasilania, aby wyjść.",
+	[20] = " Wyjmij urządzenie z pokrowca PowerCover!\nNaciśnij przycisk zasilania, aby wyjść.",
+	[21] = " Urządzenie jest podłączone do zwykłego źródła zasilania, a nie do hosta USB (na przykład komputera)!\nKOReader uruchomi się teraz ponownie…",
+	[22] = " Urządzenie jest podłączone do zwykłego źródła zasilania, a nie do hosta USB (na przykład komputera)!\nUrządzenie wyłączy się za 90 sekund.",
+	[23] = " Urządzenie było podłączone do zwykłego źródła zasilania, a nie do hosta USB (na przykład komputera)!\nKOReader zostanie teraz ponownie uruchomiony…",
+	[24] = " Urządzenie było podłączone do zwykłego źródła zasilania, a nie do hosta USB (na przykład komputera)!\nUrządzenie wyłączy się za 90 sekund.",
+	[25] = " Urządzenie wyłączy się za 90 sekund.",
+	[26] = " Błąd skryptu fuser!",
+};
+
+static const char* const tr_pt[TR_COUNT] = {
+	[0] = "Pronto!\nO KOReader vai reiniciar agora…",
+	[1] = "A encerrar a sessão USBMS…",
+	[2] = "Pressione o botão de ligar/desligar para sair.",
+	[3] = "A iniciar a sessão USBMS…",
+	[4] = "Armazenamento de massa USB",
+	[5] = "Sessão USBMS em progresso.\nPor favor ejete o seu dispositivo de modo seguro antes de desconectá-lo.",
+	[6] = "A esperar a ser conectado…\nOu pressione o botão de ligar/desligar para sair.",
+	[7] = " Desistido após 30 segundos.\nO KOReader vai reiniciar agora…",
+	[8] = " Desistido após 30 segundos.\nO dispositivo vai desligar-se em 90 segundos.",
+	[9] = " Desistido após 60 segundos.\nO KOReader vai reiniciar agora…",
+	[10] = " Desistido após 60 segundos.\nO dispositivo vai desligar-se em 90 segundos.",
+	[11] = " O KOReader vai reiniciar agora…",
+	[12] = " Não foi possível detetar um evento de desconexão!\nO dispositivo vai desligar-se em 90 segundos.",
+	[13] = " Não foi possível encerrar a sessão USBMS!\nO dispositivo vai desligar-se em 90 segundos.",
+	[14] = " Não foi possível executar o script fuser!",
+	[15] = " Não foi possível iniciar a sessão USBMS!\nO dispositivo vai desligar-se em 90 segundos.",
+	[16] = " O sistema de ficheiros está ocupado! Processos responsáveis:",
+	[17] = " Por favor desative o USBNet manualmente!\nPressione o botão de ligar/desligar para sair.",
+	[18] = " Por favor desative o USBSerial manualmente!\nPressione o botão de ligar/desligar para sair.",
+	[19] = " Por favor desative o seu dispositivo USB manualmente!\nPressione o botão de ligar/desligar para sair.",
+	[20] = " Por favor, retire o dispositivo do PowerCover!\nPressione o botão de energia para sair.",
+	[21] = " O dispositivo está conectado numa fonte de energia simples, não num host USB!\nO KOReader vai reiniciar agora…",
+	[22] = " O dispositivo está conectado numa fonte de energia simples, não num host USB!\nO dispositivo vai desligar-se em 90 segundos.",
+	[23] = " O dispositivo foi conectado numa fonte de energia simples, não num host USB!\nO KOReader vai reiniciar agora…",
+	[24] = " O dispositivo foi conectado numa fonte de energia simples, não num host USB!\nO dispositivo vai desligar-se em 90 segundos.",
+	[25] = " O dispositivo vai desligar-se em 90 segundos.",
+	[26] = " O script fuser falhou!",
+};
+
+static const char* const tr_pt_BR[TR_COUNT] = {
+	[0] = "Pronto!\nO KOReader vai reiniciar agora…",
+	[1] = "Encerrando a sessão USBMS…",
+	[2] = "Pressione o botão de ligar/desligar para sair.",
+	[3] = "Iniciando a sessão USBMS…",
+	[4] = "Armazenamento de massa USB",
+	[5] = "Sessão USBMS em progresso.\nPor favor ejete seu dispositivo de modo seguro antes de desconectá-lo.",
+	[6] = "Esperando para ser conectado…\nOu pressione o botão de ligar/desligar para sair.",
+	[7] = " Desistido após 30 segundos.\nO KOReader vai reiniciar agora…",
+	[8] = " Desistido após 30 segundos.\nO dispositivo vai se desligar em 90 segundos.",
+	[9] = " Desistido após 60 segundos.\nO KOReader vai reiniciar agora…",
+	[10] = " Desistido após 60 segundos.\nO dispositivo vai se desligar em 90 segundos.",
+	[11] = " O KOReader vai reiniciar agora…",
+	[12] = " Não foi possível detectar um evento de desconexão!\nO dispositivo vai se desligar em 90 segundos.",
+	[13] = " Não foi possível encerrar a sessão USBMS!\nO dispositivo vai se desligar em 90 segundos.",
+	[14] = " Não foi possível executar o script fuser!",
+	[15] = " Não foi possível iniciar a sessão USBMS!\nO dispositivo vai se desligar em 90 segundos.",
+	[16] = " O sistema de arquivos está ocupado! Processos responsáveis:",
+	[17] = " Por favor desative o USBNet manualmente!\nPressione o botão de ligar/desligar para sair.",
+	[18] = " Por favor desative o USBSerial manualmente!\nPressione o botão de ligar/desligar para sair.",
+	[19] = " Por favor desative o seu dispositivo USB manualmente!\nPressione o botão de ligar/desligar para sair.",
+	[20] = " Por favor, retire o dispositivo do PowerCover!\nPressione o botão de energia para sair.",
+	[21] = " O dispositivo está conectado em uma fonte de energia simples, não em um host USB!\nO KOReader vai reiniciar agora…",
+	[22] = " O dispositivo está conectado em uma fonte de energia simples, não em um host USB!\nO dispositivo vai se desligar em 90 segundos.",
+	[23] = " O dispositivo foi conectado em uma fonte de energia simples, não em um host USB!\nO KOReader vai reiniciar agora…",
+	[24] = " O dispositivo foi conectado em uma fonte de energia simples, não em um host USB!\nO dispositivo vai se desligar em 90 segundos.",
+	[25] = " O dispositivo vai se desligar em 90 segundos.",
+	[26] = " O script fuser falhou!",
+};
+
+static const char* const tr_pt_PT[TR_COUNT] = {
+	[0] = "Pronto!\nO KOReader vai reiniciar agora…",
+	[1] = "A encerrar a sessão USBMS…",
+	[2] = "Pressione o botão de ligar/desligar para sair.",
+	[3] = "Iniciando a sessão USBMS…",
+	[4] = "Armazenamento em Massa de USB",
+	[5] = "Sessão USBMS em progresso.\nPor favor, ejete o seu aparelho de modo seguro antes de o desligar.",
+	[6] = "À espera para ser ligado…\nOu pressione o botão de ligar/desligar para sair.",
+	[7] = " Desistido após 30 segundos.\nO KOReader vai reiniciar agora…",
+	[8] = " Desistido após 30 segundos.\nO aparelho vai desligar-se em 90 segundos.",
+	[9] = " Desistência após 60 segundos.\nO KOReader vai reiniciar agora…",
+	[10] = " Desistência após 60 segundos.\nO aparelho vai desligar-se em 90 segundos.",
+	[11] = " O KOReader vai reiniciar agora…",
+	[12] = " Não foi possível detetar um evento para desligar!\nO aparelho vai desligar-se em 90 segundos.",
+	[13] = " Não foi possível encerrar a sessão USBMS!\nO aparelho vai desligar-se em 90 segundos.",
+	[14] = " Não foi possível executar o script fuser!",
+	[15] = " Não foi possível iniciar a sessão USBMS!\nO aparelho vai desligar-se em 90 segundos.",
+	[16] = " O sistema de ficheiros está ocupado! Processos responsáveis:",
+	[17] = " Por favor, desative manualmente o USBNet!\nPressione o botão de ligar/desligar para sair.",
+	[18] = " Por favor, desative manualmente o USBSerial!\nPressione o botão de ligar/desligar para sair.",
+	[19] = " Por favor, desative manualmente o seu dispositivo USB!\nPressione o botão de ligar/desligar para sair.",
+	[20] = " Por favor, retire o aparelho do PowerCover!\nPressione o botão de energia para sair.",
+	[21] = " O aparelho está ligado a uma fonte de energia, não num dispositivo USB!\nO KOReader vai reiniciar agora…",
+	[22] = " O aparelho está ligado a uma fonte de energia, não a um dispositivo USB!\nO aparelho vai desligar-se em 90 segundos.",
+	[23] = " O aparelho foi ligado a um fonte de energia, não num dispositivo USB!\nO KOReader vai reiniciar agora…",
+	[24] = " O aparelho foi ligado numa fonte de energia, não a um dispositivo USB!\nO aparelho vai desligar-se em 90 segundos.",
+	[25] = " O aparelho vai desligar-se em 90 segundos.",
+	[26] = " O script fuser falhou!",
+};
+
+static const char* const tr_ro[TR_COUNT] = {
+	[0] = "Gata!\nKOReader va reporni acum…",
+	[1] = "Se încheie sesiunea USBMS…",
+	[2] = "Apasă butonul de pornire pentru a ieși.",
+	[3] = "Se pornește sesiunea USBMS…",
+	[4] = "Stocare în masă USB",
+	[5] = "Sesiune USBMS în progress.\nTe rog elimină în siguranță dispozitivul înainte de a-l deconecta.",
+	[6] = "Se așteaptă conectarea cablului…\nSau apasă butonul de pornire pentru a ieși.",
+	[7] = "S-a renunțat după 30 sec.\nKOReader se va reporni acum…",
+	[8] = " S-a renunțat după 30 sec.\nDispozitivul se va închide în 90 sec.",
+	[9] = "S-a renunțat după 60 sec.\nKOReader va reporni acum…",
+	[10] = " S-a renunțat după 60 sec.\nDispozitivul se va închide în 90 sec.",
+	[11] = " KOReader se va reporni acum…",
+	[12] = " Nu s-a detectat un eveniment de deconectare!\nDispozitivul se va închide în 90 sec.",
+	[13] = " Nu s-a putut încheia sesiunea USBMS!\nDispozitivul se va închide în 90 sec.",
+	[14] = " Nu s-a putut rula scriptul fuser!",
+	[15] = " Nu s-a putut porni sesiunea USBMS!\nDispozitivul se va închide în 90 sec.",
+	[16] = " Sistemul de fișiere este ocupat! Procesele care îl țin ocupat sunt:",
+	[17] = " Te rog dezactivează manual USBNetl!\nApasă butonul de pornire pentru a ieși.",
+	[18] = " Te rog dezactivează manual USBSerial!\nApasă butonul de pornire pentru a ieși.",
+	[19] = " Te rog dezactivează manual dispozitivul tău USB!\nApasă butonul de pornire pentru a ieși.",
+	[20] = " Te rog scoate dispozitivul din coperta cu baterie!\nApasă butonul de pornire pentru a ieși.",
+	[21] = " Dispozitivul a fost conectat la un încărcător USB, nu la o gazdă USB!\nKOReader va reporni acum…",
+	[22] = " Dispozitivul a fost conectat la un încărcător USB, nu la o gazdă USB!\nDispozitivul se va închide în 90 sec.",
+	[23] = " Dispozitivul a fost conectat la un încărcător USB, nu la o gazdă USB!\nKOReader va reporni acum…",
+	[24] = " Dispozitivul a fost conectat la un încărcător USB, nu la o gazdă USB!\nDispozitivul se va închide în 90 sec.",
+	[25] = " Dispozitivul se va închide în 90 sec.",
+	[26] = " Scriptul fuser a eșuat!",
+};
+
+static const char* const tr_ro_MD[TR_COUNT] = {
+	[0] = "Gata!\nKOReader va reporni acum…",
+	[1] = "Se încheie sesiunea USBMS…",
+	[2] = "Apasă butonul de pornire pentru a ieși.",
+	[3] = "Se pornește sesiunea USBMS…",
+	[4] = "Stocare în masă USB",
+	[5] = "Sesiune USBMS în progress.\nTe rog elimină în siguranță dispozitivul înainte de a-l deconecta.",
+	[6] = "Se așteaptă conectarea cablului…\nSau apasă butonul de pornire pentru a ieși.",
+	[7] = "S-a renunțat după 30 sec.\nKOReader se va reporni acum…",
+	[8] = " S-a renunțat după 30 sec.\nDispozitivul se va închide în 90 sec.",
+	[9] = "S-a renunțat după 60 sec.\nKOReader va reporni acum…",
+	[10] = " S-a renunțat după 60 sec.\nDispozitivul se va închide în 90 sec.",
+	[11] = " KOReader se va reporni acum…",
+	[12] = " Nu s-a detectat un eveniment de deconectare!\nDispozitivul se va închide în 90 sec.",
+	[13] = " Nu s-a putut încheia sesiunea USBMS!\nDispozitivul se va închide în 90 sec.",
+	[14] = " Nu s-a putut rula scriptul fuser!",
+	[15] = " Nu s-a putut porni sesiunea USBMS!\nDispozitivul se va închide în 90 sec.",
+	[16] = " Sistemul de fișiere este ocupat! Procesele care îl țin ocupat sînt:",
+	[17] = " Te rog dezactivează USBNet manual!\nApasă butonul de pornire pentru a ieși.",
+	[18] = " Te rog dezactivează USBSerial manual!\nApasă butonul de pornire pentru a ieși.",
+	[19] = " Te rog dezactivează dispozitivul tău USB manual!\nApasă butonul de pornire pentru a ieși.",
+	[20] = " Te rog scoate dispozitivul din coperta cu baterie!\nApasă butonul de pornire pentru a ieși.",
+	[21] = " Dispozitivul a fost conectat la un încărcător USB, nu la o gazdă USB!\nKOReader va reporni acum…",
+	[22] = " Dispozitivul a fost conectat la un încărcător USB, nu la o gazdă USB!\nDispozitivul se va închide în 90 sec.",
+	[23] = " Dispozitivul a fost conectat la un încărcător USB, nu la o gazdă USB!\nKOReader va reporni acum…",
+	[24] = " Dispozitivul a fost conectat la un încărcător USB, nu la o gazdă USB!\nDispozitivul se va închide în 90 sec.",
+	[25] = " Dispozitivul se va închide în 90 sec.",
+	[26] = " Scriptul fuser a eșuat!",
+};
+
+static const char* const tr_ru[TR_COUNT] = {
+	[0] = "Готово!\nСейчас KOReader перезапустится…",
+	[1] = "Завершение сеанса USBMS…",
+	[2] = "Нажмите кнопку питания, чтобы выйти.",
+	[3] = "Начало сеанса USBMS…",
+	[4] = "Накопитель USB",
+	[5] = "Работающий сеанс USBMS.\nВыполняйте безопасное отключение, прежде чем извлекать кабель.",
+	[6] = "Ожидается подключение к устройству...\nИли нажмите кнопку питания для выхода.",
+	[7] = " Попытки прекращены по истечении 30 секунд.\nСейчас KOReader перезапустится…",
+	[8] = " Попытки прекращены по истечении 30 секунд.\nУстройство будет выключено через 90 секунд.",
+	[9] = " Попытки прекращены по истечении 60 секунд.\nСейчас KOReader перезапустится…",
+	[10] = " Попытки прекращены по истечении 60 секунд.\nУстройство будет отключено через 90 секунд.",
+	[11] = "Сейчас KOReader перезапустится…",
+	[12] = " Не удалось обнаружить событие отключения!\nУстройство выключится через 90 секунд.",
+	[13] = " Не удалось завершить сеанс USBMS!\nУстройство выключится через 90 секунд.",
+	[14] = " Не удалось запустить скрипт fuser!",
+	[15] = " Не удалось запустить сеанс USBMS!\nУстройство выключится через 90 секунд.",
+	[16] = " Файловая система занята! Мешающие процессы:",
+	[17] = " Отключите USBNet вручную!\nНажмите кнопку питания, чтобы выйти.",
+	[18] = " Пожалуйста, отключите USBSerial вручную!\nНажмите кнопку питания, чтобы выйти.",
+	[19] = " Отключите своё USB-устройство вручную.\nДля выхода нажмите кнопку питания.",
+	[20] = " Пожалуйста, извлеките устройство из обложки PowerCover!\nНажмите на кнопку питания, чтобы выйти.",
+	[21] = "Устройство было подключено к блоку питания, а не USB-хосту!\nСейчас KOReader перезапустится…",
+	[22] = " Устройство подключено к блоку питания, а не к USB-хосту!\nУстройство будет отключено через 90 секунд.",
+	[23] = "Устройство было подключено к блоку питания, а не USB-хосту!\nСейчас KOReader перезапустится…",
+	[24] = " Устройство было подключено к блоку питания, а не USB-хосту!\nУстройство выключится через 90 секунд.",
+	[25] = " Устройство будет выключено через 90 секунд.",
+	[26] = " В скрипте-обёртке команды fuser произошла ошибка!",
+};
+
+static const char* const tr_sk[TR_COUNT] = {
+	[0] = "Hotovo!\nKOReader sa teraz reštartuje…",
+	[1] = "Ukončovanie USBMS…",
+	[2] = "Stlačte tlačidlo napájania pre ukončenie.",
+	[3] = "Spustenie USBMS…",
+	[4] = "Veľkokapacitné úložisko USB",
+	[5] = "USBMS je spustené.\nZariadenie prosím softvérovo bezpečne vysuňte predtým, než ho fyzicky odpojíte.",
+	[6] = "Čakanie na zapojenie...\nAlebo stlačte tlačidlo napájania pre ukončenie.",
+	[7] = " Po 30 sekundách som to vzdal.\nKOReader sa teraz reštartuje…",
+	[8] = " Po 30 sekundách som to vzdal.\nZariadenie sa vypne o 90 sekúnd.",
+	[9] = " Po 60 sekundách som to vzdal.\nKOReader sa teraz reštartuje…",
+	[10] = " Po 60 sekundách som to vzdal.\nZariadenie sa vypne o 90 sekúnd.",
+	[11] = " KOReader sa teraz reštartuje…",
+	[12] = " Nepodarilo sa mi zaznamenať udalosť odpojenia!\nZariadenie sa vypne o 90 sek.",
+	[13] = " Nepodarilo sa ukončiť USBMS!\nZariadenie sa vypne o 90 sek.",
+	[14] = " Nepodarilo sa spustiť zaisťovací skript!",
+	[15] = " Nemôžem spustiť USBMS!\nZariadenie sa vypne o 90 sek.",
+	[16] = " Súborový systém je zaneprázdnený! Problémové procesy:",
+	[17] = " Vypnite prosím USBNet manuálne!\nStlačte tlačidlo napájania pre ukončenie.",
+	[18] = " Vypnite prosím USBSerial manuálne!\nStlačte tlačidlo napájania pre ukončenie.",
+	[19] = " Prosím vypnite vaše USB zariadenie manuálne!\nStlačte tlačidlo napájania pre ukončenie.",
+	[20] = " Prosím, vezmite zariadenie z PowerCover!\nStlačte tlačidlo napájania pre ukončenie.",
+	[21] = " Zariadenie je pripojené na napájací zdroj, nie na USB hostiteľa!\nKOReader sa teraz reštartuje…",
+	[22] = " Zariadenie je pripojené na napájací zdroj, nie na USB hostiteľa!\nZariadenie sa vypne o 90 sekúnd.",
+	[23] = " Zariadenie bolo pripojené na napájací zdroj, nie na USB hostiteľa!\nKOReader sa teraz reštartuje…",
+	[24] = " Zariadenie bolo pripojené na napájací zdroj, nie na USB hostiteľa!\nZariadenie sa vypne o 90 sekúnd.",
+	[25] = " Zariadenie sa vypne o 90 sekúnd.",
+	[26] = " Zaisťovací skript zlyhal!",
+};
+
+static const char* const tr_sl[TR_COUNT] = {
+	[0] = "Končano!\nKOReader se bo zdaj ponovno zagnal…",
+	[1] = "Končevanje seje USBMS…",
+	[2] = "Pritisni gumb za vklop za izhod.",
+	[3] = "Zaganjanje seje USBMS…",
+	[4] = "USB masovni pomnilnik",
+	[5] = "Seja USBMS poteka.\nVarno odstrani napravo, preden jo izključiš.",
+	[6] = "Čakanje na priklop…\nAli pritisni gumb za vklop za izhod.",
+	[7] = " Odnehano po 30 sekundah.\nKOReader se bo zdaj ponovno zagnal…",
+	[8] = " Odnehano po 30 sekundah.\nNaprava se bo izklopila čez 90 sekund.",
+	[9] = " Odnehano po 60 sekundah.\nKOReader se bo zdaj ponovno zagnal…",
+	[10] = " Odnehano po 60 sekundah.\nNaprava se bo izklopila čez 90 sekund.",
+	[11] = " KOReader se bo zdaj ponovno zagnal…",
+	[12] = " Izklopa ni bilo mogoče zaznati!\nNaprava se bo izklopila čez 90 sekund.",
+	[13] = " Seje USBMS ni bilo mogoče končati!\nNaprava se bo izklopila čez 90 sekund.",
+	[14] = " Skripte fuser ni bilo mogoče zagnati!",
+	[15] = " Seje USBMS ni bilo mogoče zagnati!\nNaprava se bo izklopila čez 90 sekund.",
+	[16] = " Datotečni sistem je zaseden! Procesi, ki povzročajo težave:",
+	[17] = " Ročno onemogoči USBNet!\nPritisni gumb za vklop za izhod.",
+	[18] = " Ročno onemogoči USBSerial!\nPritisni gumb za vklop za izhod.",
+	[19] = " Ročno onemogoči svoj USB pripomoček po meri!\nPritisni gumb za vklop za izhod.",
+	[20] = " Odstrani napravo iz ovitka PowerCover!\nPritisni gumb za vklop za izhod.",
+	[21] = " Naprava je priključena na navaden vir napajanja, ne na gostitelja USB!\nKOReader se bo zdaj ponovno zagnal…",
+	[22] = " Naprava je priključena na navaden vir napajanja, ne na gostitelja USB!\nNaprava se bo izklopila čez 90 sekund.",
+	[23] = " Naprava je bila priključena na navaden vir napajanja, ne na gostitelja USB!\nKOReader se bo zdaj ponovno zagnal…",
+	[24] = " Naprava je bila priključena na navaden vir napajanja, ne na gostitelja USB!\nNaprava se bo izklopila čez 90 sekund.",
+	[25] = " Naprava se bo izklopila čez 90 sekund.",
+	[26] = " Skripta fuser ni uspela!",
+};
+
+static const char* const tr_sr[TR_COUNT] = {
+	[0] = "Готово!\nKOReader ће се сада поново покренути…",
+	[1] = "Завршава се USBMS сесија…",
+	[2] = "Притисните дугме за укључивање да изађете.",
+	[3] = "Покреће се USBMS сесија…",
+	[4] = "USB масовно складиште",
+	[5] = "USBMS сесија је активна.\nМолимо вас да уређај безбедно одјавите пре него што откачите кабл.",
+	[6] = "Чека се прикључивање кабла…\nИли, притисните дугме за укључивање да изађете.",
+	[7] = " Одустало се након 30 сек.\nKOReader ће се сада поново покренути…",
+	[8] = " Одустало се након 30 сек.\nУређај ће се искључити за 90 сек.",
+	[9] = " Одустало се након 60 сек.\nKOReader ће се сада поново покренути…",
+	[10] = " Одустало се након 60 сек.\nУређај ће се искључити за 90 sec.",
+	[11] = " KOReader ће се сада поново покренути…",
+	[12] = " Није могао да се детектује догађај одјављивања!\nУређај ће се искључити за 90 сек.",
+	[13] = " Није могла да се заврши USBMS сесија!\nУређај ће се искључити за 90 sec.",
+	[14] = " Fuser скрипта није могла да се покрене!",
+	[15] = " Није могла да се покрене USBMS сесија!\nУређај ће се искључити за 90 sec.",
+	[16] = " Фајл систем је заузет! Процеси који праве проблем:",
+	[17] = " Молимо вас да ручно искључите USBNet!\nПритисните дугме за укључивање да изађете.",
+	[18] = " Молимо вас да ручно искључите USBSerial!\nПритисните дугме за укључивање да изађете.",
+	[19] = " Молимо вас да ручно искључите USB уређај!\nПритисните дугме за укључивање да изађете.",
+	[20] = " Молимо вас да извадите уређај из PowerCover!\nПритисните дугме за укључивање да изађете.",
+	[21] = " Уређај је прикључен на обичан извор напајања, а не на USB хост!\nKOReader ће се сада поново покренути…",
+	[22] = " Уређај је прикључен на обичан извор напајања, а не на USB хост!\nУређај ће се искључити за 90 сек.",
+	[23] = " Уређај је прикључен на обичан извор напајања, а не на USB хост!\nKOReader ће се сада поново покренути…",
+	[24] = " Уређај је прикључен на обичан извор напајања, а не на USB хост!\nУређај ће се искључити за 90 сек.",
+	[25] = " Уређај ће се искључити за 90 сек.",
+	[26] = " Fuser скрипта се није извршила успешно!",
+};
+
+static const char* const tr_ta[TR_COUNT] = {
+	[0] = "முடிந்தது!\n கொரியடர் இப்போது மறுதொடக்கம் செய்வார்…",
+	[1] = "USBMS அமர்வை முடித்தல்…",
+	[2] = "வெளியேற பவர் பொத்தானை அழுத்தவும்.",
+	[3] = "யு.எச்.பி.எம்.எச் அமர்வைத் தொடங்குகிறது…",
+	[4] = "யூ.எச்.பி வெகுசன சேமிப்பு",
+	[5] = "யு.எச்.பி.எம்.எச் அமர்வு முன்னேற்றத்தில் உள்ளது.\n உங்கள் சாதனத்தை அவிழ்ப்பதற்கு முன் பாதுகாப்பாக வெளியேற்றவும்.",
+	[6] = "செருகப்படுவதற்கு காத்திருக்கிறது…\n அல்லது, வெளியேற ஆற்றல் பொத்தானை அழுத்தவும்.",
+	[7] = "30 வினாடிக்குப் பிறகு கைவிடப்பட்டது.\nகொரியடர் இப்போது மறுதொடக்கம் செய்வார்…",
+	[8] = "30 வினாடிக்குப் பிறகு கைவிடப்பட்டது.\nசாதனம் 90 நொடியில் மூடப்படும்.",
+	[9] = "60 நொடியுக்குப் பிறகு கைவிட்டன.\nகொரியடர் இப்போது மறுதொடக்கம் செய்வார்…",
+	[10] = "60 நொடியுக்குப் பிறகு கைவிட்டன.\nசாதனம் 90 நொடியில் மூடப்படும்.",
+	[11] = " கொரியடர் இப்போது மறுதொடக்கம் செய்வார்…",
+	[12] = "An ஒரு அவிழ்த்து நிகழ்வைக் கண்டறிய முடியவில்லை!\n சாதனம் 90 நொடியில் மூடப்படும்.",
+	[13] = "USBMS அமர்வை முடிக்க முடியவில்லை!\n சாதனம் 90 நொடியில் மூடப்படும்.",
+	[14] = "Fus பியூசர் ச்கிரிப்டை இயக்க முடியவில்லை!",
+	[15] = "USBMS அமர்வைத் தொடங்க முடியவில்லை!\n சாதனம் 90 நொடியில் மூடப்படும்.",
+	[16] = "மண்டலம் கோப்பு முறைமை பிசியாக உள்ளது! புண்படுத்தும் செயல்முறைகள்:",
+	[17] = "USBNET ஐ கைமுறையாக முடக்கவும்!\n வெளியேற பவர் பொத்தானை அழுத்தவும்.",
+	[18] = "Us தயவுசெய்து usbserial ஐ கைமுறையாக முடக்கவும்!\n வெளியேற பவர் பொத்தானை அழுத்தவும்.",
+	[19] = "தனிப்பயன் உங்கள் தனிப்பயன் யூ.எச்.பி கேசெட்டை கைமுறையாக முடக்கவும்!\n வெளியேற பவர் பொத்தானை அழுத்தவும்.",
+	[20] = "விசை தயவுசெய்து சாதனத்தை பவர் கவர் வெளியே எடுத்துச் செல்லுங்கள்!\n வெளியேற பவர் பொத்தானை அழுத்தவும்.",
+	[21] = "The சாதனம் ஒரு எளிய ஆற்றல் மூலத்தில் செருகப்படுகிறது, யூ.எச்.பி புரவலன் அல்ல!\n கொரியடர் இப்போது மறுதொடக்கம் செய்வார்…",
+	[22] = "The சாதனம் ஒரு எளிய ஆற்றல் மூலத்தில் செருகப்படுகிறது, யூ.எச்.பி புரவலன் அல்ல!\n சாதனம் 90 நொடியில் மூடப்படும்.",
+	[23] = "The சாதனம் ஒரு எளிய ஆற்றல் மூலத்தில் செருகப்பட்டது, யூ.எச்.பி புரவலன் அல்ல!\n கொரியடர் இப்போது மறுதொடக்கம் செய்வார்…",
+	[24] = "The சாதனம் ஒரு எளிய ஆற்றல் மூலத்தில் செருகப்பட்டது, யூ.எச்.பி புரவலன் அல்ல!\n சாதனம் 90 நொடியில் மூடப்படும்.",
+	[25] = "90 சாதனம் 90 நொடியில் மூடப்படும்.",
+	[26] = "Per பியூசர் ச்கிரிப்ட் தோல்வியடைந்தது!",
+};
+
+static const char* const tr_th[TR_COUNT] = {
+	[0] = "ทำงานเสร็จเรียบร้อย!\nKOReader จะเริ่มทำงานใหม่เดี๋ยวนี้…",
+	[1] = "กำลังสิ้นสุดกระบวนการ USBMS …",
+	[2] = "กดปุ่ม Power เพื่อจบการทำงาน",
+	[3] = "กำลังเริ่มกระบวนการ USBMS …",
+	[4] = "ตัวเก็บข้อมูลแบบ USB",
+	[5] = "กระบวนการ USBMS กำลังทำงานอยู่\nกรุณาถอดเครื่องของคุณออกอย่างปลอดภัยก่อนที่จะถอดปลั๊ก",
+	[6] = "กำลังรอให้เสียบปลั๊ก...\nหรือ กดปุ่ม Power เพื่อจบการทำงาน",
+	[7] = " ยกเลิกการทำงานหลังจากผ่านไป 30 วินาที\nKOReader จะเริ่มทำงานใหม่เดี๋ยวนี้…",
+	[8] = " ยกเลิกการทำงานหลังจากผ่านไป 30 วินาที\nตัวเครื่องจะถูกปิดภายใน 90 วินาที",
+	[9] = " ยกเลิกการทำงานหลังจากผ่านไป 60 วินาที\nKOReader จะเริ่มทำงานใหม่เดี๋ยวนี้…",
+	[10] = " ยกเลิกการทำงานหลังจากผ่านไป 60 วินาที\nตัวเครื่องจะถูกปิดภายใน 90 วินาที",
+	[11] = " KOReader จะเริ่มทำงานใหม่เดี๋ยวนี้…",
+	[12] = " ตรวจไม่พบการถอดปลั๊ก!\nตัวเครื่องจะถูกปิดภายใน 90 วินาที",
+	[13] = " ไม่สามารถสิ้นสุดกระบวนการ USBMS!\nตัวเครื่องจะถูกปิดภายใน 90 วินาที",
+	[14] = " Fuser script ไม่สามารถทำงานได้!",
+	[15] = " ไม่สามารถเริ่มทำกระบวนการ USBMS!\nตัวเครื่องจะถูกปิดภายใน 90 วินาที",
+	[16] = " ระบบไฟล์ไม่ว่าง! เป็นการทำงานที่ฝ่าฝืนกระบวนการปกติ:",
+	[17] = " กรุณาปิดการใช้งาน USBNet ด้วยตนเอง\nกดปุ่ม Power เพื่อจบการทำงาน",
+	[18] = " กรุณาปิดการใช้งาน USBSerial ด้วยตนเอง\nกดปุ่ม Power เพื่อจบการทำงาน",
+	[19] = " กรุณาปิดการใช้งาน USBNet ด้วยตนเอง\nกดปุ่ม Power เพื่อจบการทำงาน",
+	[20] = " กรุณาแกะตัวเครื่องออกจาก PowerCover!\nกดปุ่ม Power เพื่อจบการทำงาน",
+	[21] = " ตัวเครื่องถูกเสียบเข้าแหล่งจ่ายไฟธรรมดา, ไม่ใช่อุปกรณ์ USB Host!\nKOReader จะเริ่มทำงานใหม่เดี๋ยวนี้…",
+	[22] = " ตัวเครื่องถูกเสียบเข้าแหล่งจ่ายไฟธรรมดา, ไม่ใช่อุปกรณ์ USB Host!\nตัวเครื่องจะถูกปิดภายใน 90 วินาที",
+	[23] = " ตัวเครื่องถูกเสียบเข้าแหล่งจ่ายไฟธรรมดา, ไม่ใช่อุปกรณ์ USB Host!\nKOReader จะเริ่มทำงานใหม่เดี๋ยวนี้…",
+	[24] = " ตัวเครื่องถูกเสียบเข้าแหล่งจ่ายไฟธรรมดา, ไม่ใช่อุปกรณ์ USB Host!\nตัวเครื่องจะถูกปิดภายใน 90 วินาที",
+	[25] = " ตัวเครื่องจะถูกปิดภายใน 90 วินาที",
+	[26] = "Fuser script ทำงานล้มเหลว!",
+};
+
+static const char* const tr_tr[TR_COUNT] = {
+	[0] = "Tamamlandı!\nKOReader şimdi yeniden başlatılacak…",
+	[1] = "USBMS oturumu sonlandırılıyor…",
+	[2] = "Çıkmak için güç düğmesine basın.",
+	[3] = "USBMS oturumu başlatılıyor…",
+	[4] = "USB Depolama Aygıtı",
+	[5] = "USBMS oturumu sürüyor.\nLütfen bağlantıyı kesmeden önce aygıtınızı güvenli bir şekilde çıkarın.",
+	[6] = "Takılması bekleniyor…\nYa da çıkmak için güç düğmesine basın.",
+	[7] = " 30 saniye sonra vazgeçildi.\nKOReader şimdi yeniden başlayacak…",
+	[8] = " 30 saniye sonra vazgeçildi.\nAygıt 90 saniye içinde kapanacak.",
+	[9] = " 60 saniye sonra vazgeçildi.\nKOReader şimdi yeniden başlayacak…",
+	[10] = " 60 saniye sonra vazgeçildi.\nAygıt 90 saniye içinde kapanacak.",
+	[11] = " KOReader şimdi yeniden başlayacak…",
+	[12] = " Bağlantıyı kesme olayı algılanamadı!\nAygıt 90 saniye içinde kapanacak.",
+	[13] = " USBMS oturumu sonlandırılamadı!\nAygıt 90 saniye içinde kapanacak.",
+	[14] = " fuser betiği çalıştırılamadı!",
+	[15] = " USBMS oturumunu başlatılamadı!\nAygıt 90 saniye içinde kapanacak.",
+	[16] = " Dosya sistemi meşgul! Engelleyen işlemler:",
+	[17] = " Lütfen USBNet'i el ile devre dışı bırakın!\nÇıkmak için güç düğmesine basın.",
+	[18] = " Lütfen USBSerial'ı el ile devre dışı bırakın!\nÇıkmak için güç düğmesine basın.",
+	[19] = " Lütfen özel USB aygıtınızı el ile devre dışı bırakın!\nÇıkmak için güç düğmesine basın.",
+	[20] = " Lütfen aygıtı güç kapağından çıkarın! \nÇıkmak için güç düğmesine basın.",
+	[21] = " Aygıt, bir USB girişine değil, düz bir güç kaynağına takıldı!\nKOReader şimdi yeniden başlatılacak…",
+	[22] = " Aygıt, bir USB girişine değil, düz bir güç kaynağına takıldı!\nAygıt 90 saniye içinde kapanacak.",
+	[23] = " Aygıt, bir USB girişine değil, düz bir güç kaynağına takıldı!\nKOReader şimdi yeniden başlatılacak…",
+	[24] = " Aygıt, bir USB girişine değil, düz bir güç kaynağına takıldı!\nAygıt 90 saniye içinde kapanacak.",
+	[25] = " Aygıt 90 saniye içinde kapanacak.",
+	[26] = " fuser betiği tamamlanamadı!",
+};
+
+static const char* const tr_uk[TR_COUNT] = {
+	[0] = "Готово!\nЗараз KOReader перезапуститься…",
+	[1] = "Завершення сеансу USBMS…",
+	[2] = "Натисніть кнопку живлення, щоб вийти.",
+	[3] = "Запуск сеансу USBMS…",
+	[4] = "USB-накопичувач",
+	[5] = "Триває сеанс USBMS.\nБезпечно вийміть пристрій перш ніж відʼєднати його.",
+	[6] = "Очікування підʼєднання…\nАбо натисніть кнопку живлення, щоб вийти.",
+	[7] = " Не вдалося впродовж 30 секунд.\nKOReader зараз перезапуститься…",
+	[8] = " Не вдалося впродовж 30 секунд.\nПристрій вимкнеться через 90 секунд.",
+	[9] = " Не вдалося впродовж 60 секунд.\nKOReader зараз перезапуститься…",
+	[10] = " Не вдалося впродовж 60 секунд.\nПристрій вимкнеться через 90 секунд.",
+	[11] = " KOReader зараз перезапуститься…",
+	[12] = " Не вдалося виявити подію відʼєднання!\nПристрій вимкнеться через 90 секунд.",
+	[13] = " Не вдалося завершити сеанс USBMS!\nПристрій вимкнеться через 90 секунд.",
+	[14] = " Не вдалося запустити скрипт fuser!",
+	[15] = " Не вдалося запустити сеанс USBMS!\nПристрій вимкнеться через 90 секунд.",
+	[16] = " Файлова система зайнята! Процеси-винуватці:",
+	[17] = " Вимкніть USBNet власноруч!\nНатисніть кнопку живлення, щоб вийти.",
+	[18] = " Вимкніть USBSerial вручну!\nНатисніть кнопку живлення, щоб вийти.",
+	[19] = " Вимкніть ваш власний USB-пристрій вручну!\nНатисніть кнопку живлення, щоб вийти.",
+	[20] = " Вийміть пристрій із PowerCover!\nНатисніть кнопку живлення, щоб вийти.",
+	[21] = " Пристрій підʼєднано до звичайного джерела живлення, а не до розʼєму USB!\nЗараз KOReader перезапуститься…",
+	[22] = " Пристрій підʼєднано до звичайного джерела живлення, а не до розʼєму USB!\nПристрій вимкнеться через 90 секунд.",
+	[23] = " Пристрій підʼєднано до звичайного джерела живлення, а не до розʼєму USB!\nЗараз KOReader перезапуститься…",
+	[24] = " Пристрій підʼєднано до простого джерела живлення, а не до розʼєму USB!\nПристрій вимкнеться через 90 секунд.",
+	[25] = " Пристрій вимкнеться через 90 секунд.",
+	[26] = " Скрипт fuser зазнав невдачі!",
+};
+
+static const char* const tr_uz[TR_COUNT] = {
+	[4] = "USB xotira qurilmasi",
+};
+
+static const char* const tr_vi[TR_COUNT] = {
+	[0] = "Hoàn tất!\nKhởi động lại KOReader…",
+	[1] = "Ngắt kết nối USB…",
+	[2] = "Ấn phím nguồn để thoát.",
+	[3] = "Bắt đầu kết nối USB…",
+	[4] = "Bộ lưu trữ USB",
+	[5] = "Kết nối USB.\nNgắt kết nối USB trước khi rút cáp.",
+	[6] = "Đang chờ gắn vào…\nẤn phím nguồn để thoát.",
+	[7] = " Hủy sau 30s.\nKhởi động lại KOReader…",
+	[8] = " Hủy sau 30s.\nTắt nguồn sau 90s.",
+	[9] = " Hủy sau 60s.\nKhởi động lại KOReader…",
+	[10] = " Hủy bỏ sau 60s.\nTắt nguồn sau 90s.",
+	[11] = " Khởi động lại KOReader…",
+	[12] = " Không phát hiện rút cáp!\nTắt nguồn sau 90s.",
+	[13] = " Không thể ngắt kết nối USB!\nTắt nguồn sau 90s.",
+	[14] = " Không thể chạy tập lệnh fuser!",
+	[15] = " Không thể kết nối USB!\nTắt nguồn sau 90s.",
+	[16] = " Tệp hệ thống bận! Quá trình lỗi:",
+	[17] = " Vui lòng tắt USBNet theo cách thủ công!\nNhấn nút nguồn để thoát.",
+	[18] = " Tắt USBSerial thủ công!\nẤn phím nguồn để thoát.",
+	[19] = " Vui lòng tắt USBNet theo cách thủ công!\nNhấn nút nguồn để thoát.",
+	[20] = " Vui lòng lấy thiết bị ra khỏi PowerCover!\nNhấn nút nguồn để thoát.",
+	[21] = " Không có kết nối USB, chỉ sạc!\nKhởi động lại KOReader…",
+	[22] = " Không có kết nối USB, chỉ sạc!\nTắt nguồn sau 90s.",
+	[23] = " Không có kết nối USB, chỉ sạc!\nKhởi động lại KOReader…",
+	[24] = " Không có kết nối USB, chỉ sạc!\nTắt nguồn sau 90s.",
+	[25] = " Tắt nguồn sau 90s.",
+	[26] = " Tập lệnh Fuser thất bại!",
+};
+
+static const char* const tr_zh_Hans[TR_COUNT] = {
+	[0] = "完成！\nKOReader 即将自动重启…",
+	[1] = "正在结束 USBMS 会话…",
+	[2] = "按开机键退出。",
+	[3] = "正在启动 USBMS 会话…",
+	[4] = "USB 存储设备",
+	[5] = "USBMS 会话正在进行中。\n请先将此设备弹出再拔掉 USB 线。",
+	[6] = "正在等待插入……\n或者，按开机键退出。",
+	[7] = " 30 秒后放弃\nKOReader 现在将重启...…",
+	[8] = "30 秒钟后放弃。\n设备将在 90 秒内关机。",
+	[9] = " 60 秒后放弃。\nKOReader 现在将重启...…",
+	[10] = " 60 秒后放弃。\n设备将在 90 秒内关机。",
+	[11] = " KOReader 现在将重启 …",
+	[12] = " 无法检测拔出事件！\n此设备将在 90 秒内关机。",
+	[13] = " 无法结束 USBMS 会话！\n此设备将在 90 秒内关机。",
+	[14] = " 无法运行 fuser 脚本！",
+	[15] = " 无法启动 USBMS 会话！\n设备将在 90 秒内关机。",
+	[16] = " 文件系统正忙！以下进程正在占用：",
+	[17] = " 请手动关闭 USBNet！\n按电源键退出。",
+	[18] = " 请手动关闭 USB 串口！\n按开机键退出。",
+	[19] = " 请手动禁用自定义 USB 工具！\n按开机键退出。",
+	[20] = " 请将设备从 PowerCover 充电壳中取出！\n按开机键退出。",
+	[21] = " 设备插入的是普通电源。而不是 USB 主机！\nKOReader 现在将重启...…",
+	[22] = " 设备插入的是普通电源，而不是 USB 主机！\n设备将在 90 秒内关机。",
+	[23] = " 该设备插入的是普通电源，而不是USB主机！\nKOReader 现在将重启...…",
+	[24] = " 该设备插入的是普通电源，而不是 USB 主机！\n设备将在 90 秒内关闭。",
+	[25] = " 设备将在 90 秒内关机。",
+	[26] = " fuser 脚本执行失败！",
+};
+
+static const char* const tr_zh_Hant[TR_COUNT] = {
+	[0] = "完成！\nKOReader 即將重新啟動…",
+	[1] = "正在結束 USBMS 作業階段…",
+	[2] = "請按下電源鍵以退出。",
+	[3] = "正在啟動 USBMS 作業階段…",
+	[4] = "USB 大容量儲存",
+	[5] = "USBMS 作業階段進行中。\n請在拔除前安全退出裝置。",
+	[6] = "等待連線中…\n或按下電源鍵以退出。",
+	[7] = " 已於 30 秒後放棄。\nKOReader 即將重新啟動…",
+	[8] = " 已於 30 秒後放棄。\n裝置將在 90 秒後關機。",
+	[9] = " 已於 60 秒後放棄。\nKOReader 即將重新啟動…",
+	[10] = " 已於 60 秒後放棄。\n裝置將在 90 秒後關機。",
+	[11] = " KOReader 即將重新啟動…",
+	[12] = " 無法偵測到拔除事件！\n裝置將在 90 秒後關機。",
+	[13] = " 無法結束 USBMS 作業階段！\n裝置將在 90 秒後關機。",
+	[14] = " 無法執行 fuser 指令腳本！",
+	[15] = " 無法啟動 USBMS 作業階段！\n裝置將在 90 秒後關機。",
+	[16] = " 檔案系統正忙！佔用的程序：",
+	[17] = " 請手動停用 USBNet！\n請按下電源鍵以退出。",
+	[18] = " 請手動停用 USBSerial！\n請按下電源鍵以退出。",
+	[19] = " 請手動停用自訂 USB 裝置！\n請按下電源鍵以退出。",
+	[20] = " 請將裝置從 PowerCover 中取出！\n請按下電源鍵以退出。",
+	[21] = " 裝置接上的是一般電源，而非 USB 主機！\nKOReader 即將重新啟動…",
+	[22] = " 裝置接上的是一般電源，而非 USB 主機！\n裝置將在 90 秒後關機。",
+	[23] = " 裝置接上的是一般電源，而非 USB 主機！\nKOReader 即將重新啟動…",
+	[24] = " 裝置接上的是一般電源，而非 USB 主機！\n裝置將在 90 秒後關機。",
+	[25] = " 裝置將在 90 秒後關機。",
+	[26] = " fuser 指令腳本執行失敗！",
+};
+
+static const USBMSTranslation tr_languages[] = {
+	{ "ar", "ar", tr_ar },
+	{ "bg", "bg", tr_bg },
+	{ "bn", "bn", tr_bn },
+	{ "ca", "ca", tr_ca },
+	{ "cs", "cs", tr_cs },
+	{ "cy", "cy", tr_cy },
+	{ "da", "da", tr_da },
+	{ "de", "de", tr_de },
+	{ "eo", "eo", tr_eo },
+	{ "es", "es", tr_es },
+	{ "et", "et", tr_et },
+	{ "fa", "fa", tr_fa },
+	{ "fi", "fi", tr_fi },
+	{ "fr", "fr", tr_fr },
+	{ "ga", "ga", tr_ga },
+	{ "gl", "gl", tr_gl },
+	{ "he", "he", tr_he },
+	{ "hi", "hi", tr_hi },
+	{ "hr", "hr", tr_hr },
+	{ "hu", "hu", tr_hu },
+	{ "id", "id", tr_id },
+	{ "it", "it", tr_it },
+	{ "kab", "kab", tr_kab },
+	{ "ko", "ko", tr_ko },
+	{ "lt", "lt", tr_lt },
+	{ "lv", "lv", tr_lv },
+	{ "nb_NO", "nb_NO", tr_nb_NO },
+	{ "nl", "nl", tr_nl },
+	{ "nn", "nn", tr_nn },
+	{ "pa_PK", "pa_PK", tr_pa_PK },
+	{ "pl", "pl", tr_pl },
+	{ "pt", "pt", tr_pt },
+	{ "pt_BR", "pt_BR", tr_pt_BR },
+	{ "pt_PT", "pt_PT", tr_pt_PT },
+	{ "ro", "ro", tr_ro },
+	{ "ro_MD", "ro_MD", tr_ro_MD },
+	{ "ru", "ru", tr_ru },
+	{ "sk", "sk", tr_sk },
+	{ "sl", "sl", tr_sl },
+	{ "sr", "sr", tr_sr },
+	{ "ta", "ta", tr_ta },
+	{ "th", "th", tr_th },
+	{ "tr", "tr", tr_tr },
+	{ "uk", "uk", tr_uk },
+	{ "uz", "uz", tr_uz },
+	{ "vi", "vi", tr_vi },
+	{ "zh_CN", "zh_Hans", tr_zh_Hans },
+	{ "zh_Hans", "zh_Hans", tr_zh_Hans },
+	{ "zh_Hant", "zh_Hant", tr_zh_Hant },
+	{ "zh_TW", "zh_Hant", tr_zh_Hant },
+};
+#define TR_LANGUAGES (sizeof(tr_languages) / sizeof(*tr_languages))
+
+#endif    // __USBMS_TRANSLATIONS_H
@@ -13,6 +13,14 @@ fi
 
 SCRIPT_NAME="$(basename "${0}")"
 
+# Report our progress to usbms, over the pipe it passes us (c.f., USBMS_PROGRESS_FD in usbms.h)
+# NOTE: Never let this abort the script.
+progress() {
+	if [ -n "${USBMS_PROGRESS_FD}" ] ; then
+		echo "PHASE ${1} ${2}%" 2>/dev/null >&"${USBMS_PROGRESS_FD}" || true
+	fi
+}
+
 # On some devices/FW versions, some of the modules are builtins, so we can't just fire'n forget...
 checked_rmmod() {
 	if grep -q "^${1} " "/proc/modules" ; then
@@ -95,6 +103,7 @@ mtk_usb() {
 	PARTITION="${DISK}0p12"
 }
 
+progress "usb" 0
 case "${PLATFORM}" in
 	"mt8113t-ntx" )
 		mtk_usb
@@ -107,12 +116,14 @@ esac
 MOUNT_ARGS="noatime,nodiratime,shortname=mixed,utf8"
 
 # NOTE: Be a tad less heavy-handed than the stock script with the amount of fscks, but do abort if it's not recoverable...
+progress "fsck" 30
 if ! dosfsck -a -w "${PARTITION}" ; then
 	if ! dosfsck -a -w "${PARTITION}" ; then
 		logger -p "DAEMON.CRIT" -t "${SCRIPT_NAME}[$$]" "Unrecoverable filesystem corruption on ${PARTITION}, aborting!"
 		exit 1
 	fi
 fi
+progress "mount" 70
 mount -t vfat -o "${MOUNT_ARGS}" "${PARTITION}" "/mnt/onboard"
 
 # Handle the SD card now (again, not dealing with the dynamic detection nonsense).
@@ -121,5 +132,7 @@ if [ -e "${PARTITION}" ] ; then
 	# NOTE: Mimic the stock script and never check the external SD card...
 	#       While I'm not necessarily a fan of this approach,
 	#       one of the benefits is that we avoid a potentially time consuming process for larger cards.
+	progress "mount" 85
 	mount -t vfat -o "${MOUNT_ARGS}" "${PARTITION}" "/mnt/sd"
 fi
+progress "mount" 100
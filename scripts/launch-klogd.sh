@@ -1,4 +1,4 @@
-#/bin/sh
+#!/bin/sh
 
 SCRIPT_NAME="$(basename "${0}")"
 
@@ -13,6 +13,14 @@ fi
 
 SCRIPT_NAME="$(basename "${0}")"
 
+# Report our progress to usbms, over the pipe it passes us (c.f., USBMS_PROGRESS_FD in usbms.h)
+# NOTE: Never let this abort the script.
+progress() {
+	if [ -n "${USBMS_PROGRESS_FD}" ] ; then
+		echo "PHASE ${1} ${2}%" 2>/dev/null >&"${USBMS_PROGRESS_FD}" || true
+	fi
+}
+
 # If we're already in the middle of an USBMS session, something went wrong...
 if grep -q -e "^g_file_storage " -e "^g_mass_storage " "/proc/modules" ; then
 	logger -p "DAEMON.ERR" -t "${SCRIPT_NAME}[$$]" "Already in an USBMS session?!"
@@ -44,10 +52,12 @@ PARTITIONS="${DISK}0p3"
 [ -e "${DISK}1p1" ] && PARTITIONS="${PARTITIONS},${DISK}1p1"
 
 # Flush to disk, and drop FS caches
+progress "sync" 0
 sync
 echo 3 > "/proc/sys/vm/drop_caches"
 
 # And now, unmount it
+progress "umount" 25
 for mountpoint in sd onboard ; do
 	DIR="/mnt/${mountpoint}"
 	if grep -q " ${DIR} " "/proc/mounts" ; then
@@ -142,6 +152,7 @@ mtk_usb() {
 	echo "11211000.usb" > "/sys/kernel/config/usb_gadget/${GADGET_NAME}/UDC"
 }
 
+progress "usb" 50
 case "${PLATFORM}" in
 	"mt8113t-ntx" )
 		mtk_usb
@@ -150,3 +161,4 @@ case "${PLATFORM}" in
 		legacy_usb
 	;;
 esac
+progress "usb" 100
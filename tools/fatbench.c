@@ -0,0 +1,380 @@
+/*
+	KoboUSBMS: USBMS helper for KOReader
+	Copyright (C) 2020-2024 NiLuJe <ninuje@gmail.com>
+	SPDX-License-Identifier: GPL-3.0-or-later
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// Host-side benchmark for the native FAT32 checker (c.f., fat/fat.h).
+// Generates sparse synthetic FAT32 images (with a Windows-like cluster size for their capacity, and a directory tree
+// whose total size scales with it), and times fat_check_volume against dosfsck -n (if it's available) on each of them.
+// Usage: make fatbench && ./Release/fatbench [-d dir] [-r runs] [-k] [size_in_GB ...]
+// (-k keeps the images around afterwards, e.g., for make pgo's training run).
+
+#ifndef _GNU_SOURCE
+#	define _GNU_SOURCE
+#endif
+
+#include "../fat/fat.h"
+
+#include <getopt.h>
+#include <inttypes.h>
+#include <linux/limits.h>
+#include <time.h>
+
+#define BENCH_BPS           512U
+#define BENCH_RESERVED      32U
+#define BENCH_FILES_PER_DIR 256U
+// Roughly one file per 4MB of capacity (i.e., a fairly full volume of ebooks)
+#define BENCH_FILES_PER_GB  256U
+
+static uint32_t
+    bench_sectors_per_cluster(uint64_t size)
+{
+	// c.f., the default cluster sizes of Windows's format
+	if (size <= 8ULL << 30U) {
+		return 8U;
+	} else if (size <= 16ULL << 30U) {
+		return 16U;
+	} else if (size <= 32ULL << 30U) {
+		return 32U;
+	}
+	return 64U;
+}
+
+static void
+    bench_dirent(unsigned char* de, const char* name, uint8_t attr, uint32_t cluster, uint32_t size)
+{
+	memset(de, ' ', 11U);
+	memcpy(de, name, strnlen(name, 11U));
+	de[11] = attr;
+	de[20] = (unsigned char) (cluster >> 16U);
+	de[21] = (unsigned char) (cluster >> 24U);
+	de[26] = (unsigned char) cluster;
+	de[27] = (unsigned char) (cluster >> 8U);
+	de[28] = (unsigned char) size;
+	de[29] = (unsigned char) (size >> 8U);
+	de[30] = (unsigned char) (size >> 16U);
+	de[31] = (unsigned char) (size >> 24U);
+}
+
+// Allocate a contiguous chain of n clusters
+static uint32_t
+    bench_alloc(uint32_t* fat, uint32_t* next, uint32_t n)
+{
+	uint32_t first = *next;
+	for (uint32_t i = 0U; i < n; i++) {
+		fat[first + i] = (i == n - 1U) ? FAT32_ENTRY_MASK : first + i + 1U;
+	}
+	*next += n;
+	return first;
+}
+
+static int
+    bench_write(int fd, const void* buf, size_t len, uint64_t offset)
+{
+	if (pwrite64(fd, buf, len, (off64_t) offset) != (ssize_t) len) {
+		fprintf(stderr, "pwrite: %m\n");
+		return -1;
+	}
+	return 0;
+}
+
+static int
+    bench_mkimage(const char* path, uint64_t size)
+{
+	int fd = open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC | O_LARGEFILE, 0644);
+	if (fd == -1) {
+		fprintf(stderr, "open(\"%s\"): %m\n", path);
+		return -1;
+	}
+
+	int            rc           = -1;
+	uint32_t*      fat          = NULL;
+	unsigned char* dir          = NULL;
+	unsigned char* root_dir     = NULL;
+	uint32_t       spc          = bench_sectors_per_cluster(size);
+	uint32_t       cluster_size = spc * BENCH_BPS;
+	uint32_t       total        = (uint32_t) (size / BENCH_BPS);
+	uint32_t       fat_sectors  = (uint32_t) ((((uint64_t) total / spc) * 4U + BENCH_BPS - 1U) / BENCH_BPS + 1U);
+	uint64_t       data_sec     = BENCH_RESERVED + 2U * (uint64_t) fat_sectors;
+	uint32_t       max_cluster  = (uint32_t) ((total - data_sec) / spc) + 1U;
+
+	if (ftruncate64(fd, (off64_t) size) == -1) {
+		fprintf(stderr, "ftruncate: %m\n");
+		goto cleanup;
+	}
+
+	// Boot sector, FSInfo, and the backup boot sector
+	unsigned char bs[BENCH_BPS] = { 0 };
+	memcpy(bs, "\xEB\x58\x90MSWIN4.1", 11U);
+	bs[FAT_BS_BYTES_PER_SEC]     = (unsigned char) BENCH_BPS;
+	bs[FAT_BS_BYTES_PER_SEC + 1] = (unsigned char) (BENCH_BPS >> 8U);
+	bs[FAT_BS_SEC_PER_CLUS]      = (unsigned char) spc;
+	bs[FAT_BS_RSVD_SEC_CNT]      = (unsigned char) BENCH_RESERVED;
+	bs[FAT_BS_NUM_FATS]          = 2U;
+	// Media descriptor
+	bs[21]                       = 0xF8;
+	memcpy(bs + FAT_BS_TOT_SEC32, &total, sizeof(total));
+	memcpy(bs + FAT_BS_FAT_SZ32, &fat_sectors, sizeof(fat_sectors));
+	bs[FAT_BS_ROOT_CLUS] = 2U;
+	bs[FAT_BS_FS_INFO]   = 1U;
+	// Backup boot sector
+	bs[50]               = 6U;
+	// Extended boot signature
+	bs[66]               = 0x29;
+	memcpy(bs + 82, "FAT32   ", 8U);
+	bs[FAT_BS_SIGNATURE]     = 0x55;
+	bs[FAT_BS_SIGNATURE + 1] = 0xAA;
+	if (bench_write(fd, bs, sizeof(bs), 0U) == -1 || bench_write(fd, bs, sizeof(bs), 6U * BENCH_BPS) == -1) {
+		goto cleanup;
+	}
+
+	fat = calloc((size_t) max_cluster + 1U, sizeof(*fat));
+	dir = calloc(1U, cluster_size);
+	if (!fat || !dir) {
+		fprintf(stderr, "calloc: %m\n");
+		goto cleanup;
+	}
+	fat[0]        = 0x0FFFFFF8U;
+	fat[1]        = FAT32_ENTRY_MASK;
+	uint32_t next = 2U;
+	uint32_t root = bench_alloc(fat, &next, 1U);
+
+	// A flat tree of directories, filled with files of varying sizes (their data is left sparse)
+	uint32_t files = (uint32_t) (size >> 30U) * BENCH_FILES_PER_GB;
+	uint32_t dirs  = (files + BENCH_FILES_PER_DIR - 1U) / BENCH_FILES_PER_DIR;
+	// With some headroom for the directories themselves
+	uint64_t avail = (uint64_t) (max_cluster - 1U) * cluster_size / 2U;
+	uint64_t mean  = avail / (files ? files : 1U);
+	if (dirs > cluster_size / FAT_DIRENT_SIZE) {
+		dirs = cluster_size / FAT_DIRENT_SIZE;
+	}
+	root_dir = calloc(1U, cluster_size);
+	if (!root_dir) {
+		fprintf(stderr, "calloc: %m\n");
+		goto cleanup;
+	}
+	uint32_t seed = 0x2237U;
+	for (uint32_t d = 0U; d < dirs; d++) {
+		// Each directory needs BENCH_FILES_PER_DIR + 2 entries
+		uint32_t dir_clusters = ((BENCH_FILES_PER_DIR + 2U) * FAT_DIRENT_SIZE + cluster_size - 1U) / cluster_size;
+		uint32_t dir_first    = bench_alloc(fat, &next, dir_clusters);
+		char     name[12]     = { 0 };
+		snprintf(name, sizeof(name), "DIR%05" PRIu32, d);
+		bench_dirent(root_dir + d * FAT_DIRENT_SIZE, name, FAT_ATTR_DIRECTORY, dir_first, 0U);
+
+		uint32_t cluster = dir_first;
+		uint32_t slot    = 0U;
+		memset(dir, 0, cluster_size);
+		bench_dirent(dir + FAT_DIRENT_SIZE * slot++, ".", FAT_ATTR_DIRECTORY, dir_first, 0U);
+		bench_dirent(dir + FAT_DIRENT_SIZE * slot++, "..", FAT_ATTR_DIRECTORY, 0U, 0U);
+		for (uint32_t f = 0U; f < BENCH_FILES_PER_DIR && d * BENCH_FILES_PER_DIR + f < files; f++) {
+			// Cheap LCG, file sizes between 0 & twice the mean
+			seed             = seed * 1103515245U + 12345U;
+			uint64_t fsize64 = (uint64_t) seed % (2U * mean + 1U);
+			uint32_t fsize   = fsize64 > UINT32_MAX ? UINT32_MAX : (uint32_t) fsize64;
+			uint32_t fclus   = (uint32_t) (((uint64_t) fsize + cluster_size - 1U) / cluster_size);
+			if (next + fclus > max_cluster) {
+				fsize = 0U;
+				fclus = 0U;
+			}
+			snprintf(name, sizeof(name), "F%07" PRIu32 "EPU", d * BENCH_FILES_PER_DIR + f);
+			if (slot == cluster_size / FAT_DIRENT_SIZE) {
+				uint64_t offset = (data_sec + (uint64_t) (cluster - 2U) * spc) * BENCH_BPS;
+				if (bench_write(fd, dir, cluster_size, offset) == -1) {
+					goto cleanup;
+				}
+				memset(dir, 0, cluster_size);
+				cluster++;
+				slot = 0U;
+			}
+			bench_dirent(
+			    dir + FAT_DIRENT_SIZE * slot++, name, 0x20, fclus ? bench_alloc(fat, &next, fclus) : 0U, fsize);
+		}
+		if (bench_write(fd, dir, cluster_size, (data_sec + (uint64_t) (cluster - 2U) * spc) * BENCH_BPS) == -1) {
+			goto cleanup;
+		}
+	}
+	rc = bench_write(fd, root_dir, cluster_size, (data_sec + (uint64_t) (root - 2U) * spc) * BENCH_BPS);
+	if (rc == -1) {
+		goto cleanup;
+	}
+
+	// FSInfo
+	unsigned char fsi[BENCH_BPS] = { 0 };
+	uint32_t      free_clusters  = max_cluster + 1U - next;
+	memcpy(fsi, "RRaA", 4U);
+	memcpy(fsi + 484, "rrAa", 4U);
+	memcpy(fsi + 488, &free_clusters, sizeof(free_clusters));
+	memcpy(fsi + 492, &next, sizeof(next));
+	fsi[510] = 0x55;
+	fsi[511] = 0xAA;
+	rc       = bench_write(fd, fsi, sizeof(fsi), BENCH_BPS);
+	for (uint32_t i = 0U; rc == 0 && i < 2U; i++) {
+		rc = bench_write(fd,
+				 fat,
+				 ((size_t) max_cluster + 1U) * sizeof(*fat),
+				 (BENCH_RESERVED + (uint64_t) i * fat_sectors) * BENCH_BPS);
+	}
+
+	printf("%s: %" PRIu64 " GB, %" PRIu32 " clusters of %" PRIu32 " bytes, %" PRIu32 " files in %" PRIu32
+	       " directories, %" PRIu32 " clusters in use\n",
+	       path,
+	       size >> 30U,
+	       max_cluster - 1U,
+	       cluster_size,
+	       files,
+	       dirs,
+	       next - 2U);
+
+cleanup:
+	free(fat);
+	free(dir);
+	free(root_dir);
+	close(fd);
+	return rc;
+}
+
+static double
+    bench_elapsed_ms(const struct timespec* start)
+{
+	struct timespec now = { 0 };
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double) (now.tv_sec - start->tv_sec) * 1000.0 + (double) (now.tv_nsec - start->tv_nsec) / 1000000.0;
+}
+
+static const char*
+    bench_find_dosfsck(void)
+{
+	if (system("command -v fsck.fat >/dev/null 2>&1") == EXIT_SUCCESS) {
+		return "fsck.fat";
+	} else if (system("command -v dosfsck >/dev/null 2>&1") == EXIT_SUCCESS) {
+		return "dosfsck";
+	}
+	return NULL;
+}
+
+int
+    main(int argc, char* argv[])
+{
+	const char* dir  = "/tmp";
+	long int    runs = 5;
+	bool        keep = false;
+	int         opt;
+	while ((opt = getopt(argc, argv, "d:r:kh")) != -1) {
+		switch (opt) {
+			case 'd':
+				dir = optarg;
+				break;
+			case 'r':
+				runs = strtol(optarg, NULL, 10);
+				if (runs < 1L) {
+					runs = 1L;
+				}
+				break;
+			case 'k':
+				keep = true;
+				break;
+			default:
+				fprintf(stderr, "Usage: %s [-d dir] [-r runs] [-k] [size_in_GB ...]\n", argv[0]);
+				return opt == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+	}
+
+	static const long int default_sizes[] = { 8, 16, 32, 64, 128 };
+	size_t                count           = (size_t) (argc - optind);
+	if (count == 0U) {
+		count = sizeof(default_sizes) / sizeof(*default_sizes);
+	}
+
+	// Keep fat.h's logging on the terminal
+	openlog("fatbench", LOG_PERROR | LOG_NDELAY, LOG_USER);
+	setlogmask(LOG_UPTO(LOG_WARNING));
+
+	const char* dosfsck = bench_find_dosfsck();
+	if (!dosfsck) {
+		printf("Neither fsck.fat nor dosfsck were found, only benchmarking the native checker\n");
+	}
+
+	int rv = EXIT_SUCCESS;
+	for (size_t i = 0U; i < count; i++) {
+		long int gb = (argc - optind) ? strtol(argv[optind + (int) i], NULL, 10) : default_sizes[i];
+		if (gb <= 0L || gb > 2047L) {
+			fprintf(stderr, "Skipping invalid size: %ld GB\n", gb);
+			continue;
+		}
+		char path[PATH_MAX] = { 0 };
+		snprintf(path, sizeof(path), "%s/fatbench-%ldG.img", dir, gb);
+		if (bench_mkimage(path, (uint64_t) gb << 30U) == -1) {
+			rv = EXIT_FAILURE;
+			continue;
+		}
+
+		double         best   = 0.0;
+		FATCheckReport report = { 0 };
+		for (long int r = 0; r < runs; r++) {
+			struct timespec start = { 0 };
+			clock_gettime(CLOCK_MONOTONIC, &start);
+			if (fat_check_volume(path, &report) != EXIT_SUCCESS) {
+				rv = EXIT_FAILURE;
+				break;
+			}
+			double ms = bench_elapsed_ms(&start);
+			if (r == 0 || ms < best) {
+				best = ms;
+			}
+		}
+		double fat_mb = (double) (report.clusters + 2U) * 4.0 / (1024.0 * 1024.0);
+		printf("  native:  %9.2f ms (best of %ld), %8.1f MB/s of FAT, %s\n",
+		       best,
+		       runs,
+		       best > 0.0 ? fat_mb / (best / 1000.0) : 0.0,
+		       fat_report_is_clean(&report) ? "clean" : "NOT clean");
+		if (!fat_report_is_clean(&report)) {
+			rv = EXIT_FAILURE;
+		}
+
+		if (dosfsck) {
+			char cmd[PATH_MAX + 64] = { 0 };
+			snprintf(cmd, sizeof(cmd), "%s -n '%s' >/dev/null 2>&1", dosfsck, path);
+			best = 0.0;
+			for (long int r = 0; r < runs; r++) {
+				struct timespec start = { 0 };
+				clock_gettime(CLOCK_MONOTONIC, &start);
+				int    ret = system(cmd);
+				double ms  = bench_elapsed_ms(&start);
+				if (ret != EXIT_SUCCESS) {
+					fprintf(stderr, "  %s flagged %s (%d)\n", dosfsck, path, ret);
+				}
+				if (r == 0 || ms < best) {
+					best = ms;
+				}
+			}
+			printf("  %-8s %9.2f ms (best of %ld), %8.1f MB/s of FAT\n",
+			       dosfsck,
+			       best,
+			       runs,
+			       best > 0.0 ? fat_mb / (best / 1000.0) : 0.0);
+		}
+
+		if (!keep) {
+			unlink(path);
+		}
+	}
+
+	closelog();
+	return rv;
+}
@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+
+# Packs our resources into a single bundle (c.f., the bundle target in the Makefile, and open_bundle in usbms.c),
+# which usbms maps once, and hands over to FBInk straight from the mapping.
+# Images are pre-decoded (to Y8, as we only ever print them on grayscale panels) and pre-scaled,
+# which saves us from having to inflate & downscale a multi-megapixel PNG on-device on every run.
+#
+# Layout (little-endian, keep it in sync with USBMSBundleHeader & USBMSBundleEntry in usbms.h!):
+# * Header: magic (8 bytes), version (u32), entry count (u32)
+# * Index: one entry per resource: NUL-padded name (48 bytes), offset, size, width, height (u32)
+# * Data: each entry's data, page-aligned, so each one can be paged in on its own
+#
+# NOTE: Fonts & scripts aren't bundled: FBInk can only load fonts from a path, and scripts have to be exec'd.
+#       The translations are already compiled in.
+
+import argparse
+import struct
+import sys
+import zlib
+
+MAGIC = b'USBMSBDL'
+VERSION = 1
+HEADER = struct.Struct('<8sII')
+ENTRY = struct.Struct('<48sIIII')
+PAGE_SIZE = 4096
+
+# c.f., print_logo in usbms.c, which scales it to a tenth of the screen's height:
+# that's under 256px on every device we support, so we only ever have to scale down from there.
+LOGO_HEIGHT = 256
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa = abs(p - a)
+    pb = abs(p - b)
+    pc = abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    elif pb <= pc:
+        return b
+    return c
+
+def decode_png(path):
+    # Just enough of a PNG decoder for our own assets: 8-bit, non-interlaced, gray/gray+alpha/RGB/RGBA
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ValueError('{}: not a PNG'.format(path))
+    pos = 8
+    idat = []
+    while pos < len(data):
+        length, kind = struct.unpack('>I4s', data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b'IHDR':
+            width, height, depth, color, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+        elif kind == b'IDAT':
+            idat.append(chunk)
+        elif kind == b'IEND':
+            break
+    channels = {0: 1, 4: 2, 2: 3, 6: 4}.get(color)
+    if depth != 8 or interlace or channels is None:
+        raise ValueError('{}: unsupported PNG flavor (depth: {}, color: {}, interlace: {})'.format(path, depth, color, interlace))
+
+    raw = zlib.decompress(b''.join(idat))
+    stride = width * channels
+    prev = bytearray(stride)
+    rows = []
+    for y in range(height):
+        kind = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        if kind == 1:
+            for i in range(channels, stride):
+                line[i] = (line[i] + line[i - channels]) & 0xFF
+        elif kind == 2:
+            line = bytearray((a + b) & 0xFF for a, b in zip(line, prev))
+        elif kind == 3:
+            for i in range(stride):
+                left = line[i - channels] if i >= channels else 0
+                line[i] = (line[i] + ((left + prev[i]) >> 1)) & 0xFF
+        elif kind == 4:
+            for i in range(stride):
+                left = line[i - channels] if i >= channels else 0
+                up_left = prev[i - channels] if i >= channels else 0
+                line[i] = (line[i] + paeth(left, prev[i], up_left)) & 0xFF
+        rows.append(line)
+        prev = line
+
+    # Y8, like FBInk would do on a grayscale panel (alpha is ignored, c.f., print_logo)
+    if channels <= 2:
+        gray = [bytes(row[::channels]) for row in rows]
+    else:
+        gray = [bytes((r * 77 + g * 150 + b * 29) >> 8 for r, g, b in zip(row[0::channels], row[1::channels], row[2::channels])) for row in rows]
+    return width, height, gray
+
+def downscale(width, height, rows, target_height):
+    # Box filter, which is plenty for a downscale
+    if height <= target_height:
+        return width, height, b''.join(rows)
+    target_width = max(1, round(width * target_height / height))
+    out = bytearray()
+    for ty in range(target_height):
+        y0 = ty * height // target_height
+        y1 = max(y0 + 1, (ty + 1) * height // target_height)
+        # Sum the source rows first, then the columns
+        sums = [0] * width
+        for row in rows[y0:y1]:
+            for x, v in enumerate(row):
+                sums[x] += v
+        for tx in range(target_width):
+            x0 = tx * width // target_width
+            x1 = max(x0 + 1, (tx + 1) * width // target_width)
+            out.append(sum(sums[x0:x1]) // ((x1 - x0) * (y1 - y0)))
+    return target_width, target_height, bytes(out)
+
+def main():
+    parser = argparse.ArgumentParser(description='Pack our resources into a single mmap-able bundle')
+    parser.add_argument('-o', '--output', required=True)
+    parser.add_argument('--logo', required=True, help='path to the KOReader logo PNG')
+    args = parser.parse_args()
+
+    entries = []
+    width, height, rows = decode_png(args.logo)
+    width, height, pixels = downscale(width, height, rows, LOGO_HEIGHT)
+    entries.append(('img/koreader', pixels, width, height))
+
+    index_size = HEADER.size + ENTRY.size * len(entries)
+    offset = (index_size + PAGE_SIZE - 1) // PAGE_SIZE * PAGE_SIZE
+    index = bytearray(HEADER.pack(MAGIC, VERSION, len(entries)))
+    blobs = bytearray()
+    for name, blob, w, h in entries:
+        index += ENTRY.pack(name.encode('utf-8'), offset, len(blob), w, h)
+        padding = (len(blob) + PAGE_SIZE - 1) // PAGE_SIZE * PAGE_SIZE - len(blob)
+        blobs += blob + bytes(padding)
+        offset += len(blob) + padding
+        print('{}: {}x{}, {} bytes'.format(name, w, h, len(blob)))
+    index += bytes(PAGE_SIZE - len(index) % PAGE_SIZE if len(index) % PAGE_SIZE else 0)
+
+    with open(args.output, 'wb') as f:
+        f.write(index)
+        f.write(blobs)
+    print('{}: {} entries, {} bytes'.format(args.output, len(entries), len(index) + len(blobs)))
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+
+# Compares a plain release build against a profile-guided one (c.f., the pgo target in the Makefile):
+# the binary sizes (via size, or just the file size if it's not available), and the per-tick hot paths,
+# as timed by the bench harness (c.f., bench/bench.c) built both ways.
+
+import argparse
+import os
+import shutil
+import subprocess
+import sys
+
+def binary_size(path):
+    # text, data, bss (c.f., size -B)
+    size = shutil.which(os.environ.get('SIZE', 'size'))
+    if size:
+        out = subprocess.run([size, '-B', path], check=True, capture_output=True, text=True).stdout
+        text, data, bss = (int(v) for v in out.splitlines()[1].split()[:3])
+        return {'text': text, 'data': data, 'bss': bss, 'file': os.path.getsize(path)}
+    return {'file': os.path.getsize(path)}
+
+def parse_bench(path):
+    # One line per benchmark: name (which may contain spaces), then min, median, mean, max (ns/op), and, optionally, cycles/op
+    results = {}
+    with open(path, encoding='utf-8') as f:
+        for line in f:
+            fields = line.split()
+            nums = []
+            while fields:
+                try:
+                    float(fields[-1])
+                except ValueError:
+                    break
+                nums.insert(0, float(fields.pop()))
+            if fields and len(nums) >= 4:
+                results[' '.join(fields)] = nums[1]
+    return results
+
+def delta(old, new):
+    return '{:+.1f}%'.format((new - old) * 100.0 / old) if old else 'n/a'
+
+def main():
+    parser = argparse.ArgumentParser(description='Report the size & hot path deltas of a PGO build vs. a release build')
+    parser.add_argument('--release', required=True, help='release usbms binary')
+    parser.add_argument('--pgo', required=True, help='PGO usbms binary')
+    parser.add_argument('--release-bench', required=True, help='output of the bench harness, release build')
+    parser.add_argument('--pgo-bench', required=True, help='output of the bench harness, PGO build')
+    args = parser.parse_args()
+
+    release = binary_size(args.release)
+    pgo = binary_size(args.pgo)
+    print('{:<34} {:>10} {:>10} {:>8}'.format('size (bytes)', 'release', 'pgo', 'delta'))
+    for key in release:
+        print('{:<34} {:>10} {:>10} {:>8}'.format(key, release[key], pgo[key], delta(release[key], pgo[key])))
+
+    release = parse_bench(args.release_bench)
+    pgo = parse_bench(args.pgo_bench)
+    print()
+    print('{:<34} {:>10} {:>10} {:>8}'.format('median (ns/op)', 'release', 'pgo', 'delta'))
+    for name in release:
+        if name in pgo:
+            print('{:<34} {:>10.1f} {:>10.1f} {:>8}'.format(name, release[name], pgo[name], delta(release[name], pgo[name])))
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
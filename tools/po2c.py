@@ -0,0 +1,194 @@
+#!/usr/bin/env python3
+
+# Compiles our translations (po/*/usbms.po) into a C header (c.f., the l10n target in the Makefile, and tr_lookup in usbms.c).
+# Every language translates the same set of msgids, so we build a single perfect hash over those,
+# mapping a msgid to its index in every per-language table, which is then a single probe (and strcmp) at runtime.
+# The hash is FNV-1a, seeded, and masked to a power of two: keep it in sync with tr_hash in usbms.c!
+
+import argparse
+import glob
+import os
+import sys
+
+PO_GLOB = 'po/*/usbms.po'
+# KOReader uses the legacy codes for Chinese
+ALIASES = {
+    'zh_CN': 'zh_Hans',
+    'zh_TW': 'zh_Hant',
+}
+MAX_SEEDS = 1 << 16
+
+ESCAPES = {'n': '\n', 't': '\t', 'r': '\r', 'a': '\a', 'b': '\b', 'f': '\f', 'v': '\v', '"': '"', '\\': '\\'}
+
+def unquote(s):
+    # A PO string is a C string literal
+    s = s.strip()
+    assert s.startswith('"') and s.endswith('"'), s
+    s = s[1:-1]
+    out = []
+    i = 0
+    while i < len(s):
+        c = s[i]
+        i += 1
+        if c != '\\':
+            out.append(c)
+        elif s[i] in ESCAPES:
+            out.append(ESCAPES[s[i]])
+            i += 1
+        else:
+            # Octal
+            j = i
+            while j < len(s) and j < i + 3 and s[j] in '01234567':
+                j += 1
+            out.append(chr(int(s[i:j], 8)))
+            i = j
+    return ''.join(out)
+
+def parse_po(path):
+    catalog = {}
+    entry = {}
+    key = None
+    fuzzy = False
+
+    def flush():
+        nonlocal entry, key, fuzzy
+        msgid = entry.get('msgid')
+        msgstr = entry.get('msgstr')
+        # Skip the header, fuzzy & untranslated entries, like msgfmt does
+        if msgid and msgstr and not fuzzy:
+            catalog[msgid] = msgstr
+        entry = {}
+        key = None
+        fuzzy = False
+
+    with open(path, encoding='utf-8') as f:
+        for line in f:
+            line = line.strip()
+            # An entry ends with its msgstr
+            if 'msgstr' in entry and not line.startswith('"'):
+                flush()
+            if not line:
+                continue
+            elif line.startswith('#,'):
+                fuzzy = 'fuzzy' in line
+            elif line.startswith('#'):
+                # Comments, references & obsolete entries
+                continue
+            elif line.startswith('"'):
+                entry[key] += unquote(line)
+            else:
+                key, _, value = line.partition(' ')
+                entry[key] = unquote(value)
+    flush()
+    return catalog
+
+def load_catalogs():
+    catalogs = {}
+    for path in sorted(glob.glob(PO_GLOB)):
+        lang = os.path.basename(os.path.dirname(path))
+        catalog = parse_po(path)
+        # Nothing translated yet, the msgids are all we'd get anyway
+        if catalog:
+            catalogs[lang] = catalog
+    return catalogs
+
+def fnv1a(seed, s):
+    h = 2166136261 ^ seed
+    for b in s.encode('utf-8'):
+        h ^= b
+        h = (h * 16777619) & 0xFFFFFFFF
+    return h
+
+def perfect_hash(keys):
+    slots = 1
+    while slots < len(keys) * 4:
+        slots <<= 1
+    while True:
+        for seed in range(MAX_SEEDS):
+            taken = set()
+            for key in keys:
+                slot = fnv1a(seed, key) & (slots - 1)
+                if slot in taken:
+                    break
+                taken.add(slot)
+            else:
+                return seed, slots
+        slots <<= 1
+
+def c_string(s):
+    out = []
+    for c in s:
+        if c == '\\':
+            out.append('\\\\')
+        elif c == '"':
+            out.append('\\"')
+        elif c == '\n':
+            out.append('\\n')
+        elif c == '\t':
+            out.append('\\t')
+        elif ord(c) < 0x20:
+            out.append('\\{:03o}'.format(ord(c)))
+        else:
+            out.append(c)
+    return '"' + ''.join(out) + '"'
+
+def c_ident(lang):
+    return 'tr_' + lang.replace('@', '_').replace('-', '_')
+
+def main():
+    parser = argparse.ArgumentParser(description='Compile our translations into a C header')
+    parser.add_argument('-o', '--output', required=True)
+    args = parser.parse_args()
+
+    catalogs = load_catalogs()
+    msgids = sorted(set().union(*(c.keys() for c in catalogs.values())))
+    assert len(msgids) < 0xFF, 'tr_slots is an uint8_t'
+    seed, slots = perfect_hash(msgids)
+    table = [0] * slots
+    for i, msgid in enumerate(msgids):
+        table[fnv1a(seed, msgid) & (slots - 1)] = i + 1
+
+    lines = []
+    lines.append('// Generated by tools/po2c.py from ' + PO_GLOB + ', do not edit! (c.f., make l10n)')
+    lines.append('')
+    lines.append('#ifndef __USBMS_TRANSLATIONS_H')
+    lines.append('#define __USBMS_TRANSLATIONS_H')
+    lines.append('')
+    lines.append('#define TR_SEED  0x{:08X}U'.format(seed))
+    lines.append('#define TR_SLOTS {}U'.format(slots))
+    lines.append('#define TR_COUNT {}U'.format(len(msgids)))
+    lines.append('')
+    lines.append('// Hash slot -> msgid index + 1 (0 if empty)')
+    lines.append('static const uint8_t tr_slots[TR_SLOTS] = {')
+    for i in range(0, slots, 16):
+        lines.append('\t' + ', '.join('{:>2}'.format(v) for v in table[i:i + 16]) + ',')
+    lines.append('};')
+    lines.append('')
+    lines.append('static const char* const tr_msgids[TR_COUNT] = {')
+    for msgid in msgids:
+        lines.append('\t' + c_string(msgid) + ',')
+    lines.append('};')
+    for lang, catalog in catalogs.items():
+        lines.append('')
+        lines.append('static const char* const {}[TR_COUNT] = {{'.format(c_ident(lang)))
+        for i, msgid in enumerate(msgids):
+            if msgid in catalog:
+                lines.append('\t[{}] = {},'.format(i, c_string(catalog[msgid])))
+        lines.append('};')
+    lines.append('')
+    lines.append('static const USBMSTranslation tr_languages[] = {')
+    entries = [(lang, lang) for lang in catalogs] + [(alias, lang) for alias, lang in ALIASES.items() if lang in catalogs]
+    for code, lang in sorted(entries):
+        lines.append('\t{{ {}, {}, {} }},'.format(c_string(code), c_string(lang), c_ident(lang)))
+    lines.append('};')
+    lines.append('#define TR_LANGUAGES (sizeof(tr_languages) / sizeof(*tr_languages))')
+    lines.append('')
+    lines.append('#endif    // __USBMS_TRANSLATIONS_H')
+
+    with open(args.output, 'w', encoding='utf-8') as f:
+        f.write('\n'.join(lines) + '\n')
+    print('{}: {} languages, {} msgids in {} slots (seed 0x{:08X})'.format(args.output, len(catalogs), len(msgids), slots, seed))
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+
+# Build-time font subsetting (c.f., the fonts target in the Makefile).
+# We only ever print a handful of glyphs, so there's no reason to have FBInk load & parse multi-MB fonts on-device.
+#
+# * The Nerd Font subset covers every codepoint usbms.c can print (icons & string literals, escaped or not),
+#   every translation (minus the CJK ones, which it can't render anyway),
+#   as well as printable ASCII & Latin-1, because we also display the output of our scripts.
+# * If a CJK font is passed (i.e., KOReader's NotoSansCJKsc-Regular.otf), we build one subset per CJK catalog,
+#   covering that translation only (c.f., the is_CJK codepath in usbms.c, which looks it up by catalog name).
+#
+# Requires fontTools' pyftsubset (pip install fonttools).
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+# We parse the catalogs the exact same way (& from the same source) as the compiled-in translations
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import po2c
+
+NERD_FONT = 'resources/fonts/CaskaydiaCove_NF.ttf'
+SOURCES = ['usbms.c']
+# Matches usbms.c's own check
+CJK_PREFIXES = ('ja', 'ko', 'zh')
+
+ESCAPE_RE = re.compile(r'\\u([0-9a-fA-F]{4})|\\U([0-9a-fA-F]{8})')
+
+def base_codepoints():
+    # Printable ASCII, Latin-1, and the replacement character
+    return set(range(0x20, 0x7F)) | set(range(0xA0, 0x100)) | {0xFFFD}
+
+def source_codepoints(paths):
+    cps = set()
+    for path in paths:
+        with open(path, encoding='utf-8') as f:
+            src = f.read()
+        for m in ESCAPE_RE.finditer(src):
+            cps.add(int(m.group(1) or m.group(2), 16))
+        # Naked UTF-8 (e.g., the ellipsis & bullet in our string literals)
+        cps.update(ord(c) for c in src if ord(c) > 0x7F)
+    return cps
+
+def catalog_codepoints(catalog):
+    cps = set()
+    for msgstr in catalog.values():
+        cps.update(ord(c) for c in msgstr if c.isprintable())
+    return cps
+
+def subset(font, cps, output, dry_run):
+    unicodes = ','.join('U+{:04X}'.format(cp) for cp in sorted(cps))
+    size = os.path.getsize(font) if os.path.isfile(font) else 0
+    print('{} -> {} ({} codepoints, from {} bytes)'.format(font, output, len(cps), size))
+    if dry_run:
+        print(unicodes)
+        return
+    # NOTE: FBInk renders via stb_truetype, which doesn't do hinting, so drop it.
+    subprocess.run(['pyftsubset', font,
+                    '--unicodes=' + unicodes,
+                    '--output-file=' + output,
+                    '--layout-features=*',
+                    '--no-hinting',
+                    '--notdef-outline'],
+                   check=True)
+    print('  {} bytes'.format(os.path.getsize(output)))
+
+def main():
+    parser = argparse.ArgumentParser(description='Subset the fonts USBMS ships to the glyphs it actually uses')
+    parser.add_argument('-o', '--output-dir', required=True)
+    parser.add_argument('--cjk-font', help="path to KOReader's NotoSansCJKsc-Regular.otf")
+    parser.add_argument('-n', '--dry-run', action='store_true', help='just print the codepoint lists')
+    args = parser.parse_args()
+
+    os.makedirs(args.output_dir, exist_ok=True)
+
+    nerd_cps = base_codepoints() | source_codepoints(SOURCES)
+    cjk_catalogs = []
+    for lang, catalog in po2c.load_catalogs().items():
+        if lang.startswith(CJK_PREFIXES):
+            cjk_catalogs.append((lang, catalog))
+        else:
+            nerd_cps |= catalog_codepoints(catalog)
+
+    name, ext = os.path.splitext(os.path.basename(NERD_FONT))
+    subset(NERD_FONT, nerd_cps, os.path.join(args.output_dir, name + '.subset' + ext), args.dry_run)
+
+    if args.cjk_font:
+        name, ext = os.path.splitext(os.path.basename(args.cjk_font))
+        for lang, catalog in cjk_catalogs:
+            cps = set(range(0x20, 0x7F)) | catalog_codepoints(catalog)
+            subset(args.cjk_font, cps, os.path.join(args.output_dir, name + '.' + lang + ext), args.dry_run)
+
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -55,6 +55,67 @@ __attribute__((format(printf, 7, 0))) static void
 	vsyslog(LOG_INFO, format, args);
 }
 
+// NOTE: Must match tools/po2c.py's fnv1a
+static uint32_t
+    tr_hash(const char* s)
+{
+	uint32_t h = 2166136261U ^ TR_SEED;
+	while (*s) {
+		h ^= (uint8_t) *s++;
+		h *= 16777619U;
+	}
+	return h;
+}
+
+// Our gettext: a single probe in the perfect hash built by tools/po2c.py
+__attribute__((format_arg(1))) static const char*
+    tr_lookup(const char* msgid)
+{
+	if (!tr_lang) {
+		return msgid;
+	}
+
+	uint8_t idx = tr_slots[tr_hash(msgid) & (TR_SLOTS - 1U)];
+	// Since it's only perfect for the msgids we know about, we still have to check that it's actually the right one
+	if (idx == 0U || strcmp(tr_msgids[idx - 1U], msgid) != 0) {
+		return msgid;
+	}
+	const char* msgstr = tr_lang->strings[idx - 1U];
+	return msgstr ? msgstr : msgid;
+}
+
+// Find the best translation for a $LANGUAGE-like list of languages (e.g., "pt_BR:pt"),
+// much like gettext: the first exact match wins, then we try again without the territory (e.g., fr_FR -> fr).
+static const USBMSTranslation*
+    tr_find(const char* languages)
+{
+	if (!languages) {
+		return NULL;
+	}
+
+	char list[128] = { 0 };
+	snprintf(list, sizeof(list), "%s", languages);
+	char* saveptr = NULL;
+	for (char* lang = strtok_r(list, ":", &saveptr); lang; lang = strtok_r(NULL, ":", &saveptr)) {
+		// Drop the codeset & modifier, if any (e.g., de_DE.UTF-8@euro)
+		lang[strcspn(lang, ".@")] = '\0';
+		while (true) {
+			for (const USBMSTranslation* tr = tr_languages; tr < tr_languages + TR_LANGUAGES; tr++) {
+				if (strcmp(tr->code, lang) == 0) {
+					return tr;
+				}
+			}
+			char* territory = strrchr(lang, '_');
+			if (!territory) {
+				break;
+			}
+			*territory = '\0';
+		}
+	}
+
+	return NULL;
+}
+
 static void
     setup_usb_ids(DEVICE_ID_T device_code)
 {
@@ -177,21 +238,86 @@ static bool
 	return !!ptr;
 }
 
+// Resolve the paths of the sysfs attributes we'll keep open, once the platform-specific ones have been figured out
+static void
+    setup_sysfs_attrs(void)
+{
+	sysfs_attrs[ATTR_BATT_STATUS].path   = usbms_backend.batt_status;
+	sysfs_attrs[ATTR_USB_ONLINE].path    = usbms_backend.usb_online;
+	sysfs_attrs[ATTR_USBC_PLUG].path     = USBC_PLUG_SYSFS;
+	sysfs_attrs[ATTR_BATT_CAP].path      = usbms_backend.batt_cap;
+	sysfs_attrs[ATTR_AUX_CONNECTED].path = CILIX_CONNECTED_SYSFS;
+	sysfs_attrs[ATTR_AUX_BATT_CAP].path  = CILIX_BATT_CAP_SYSFS;
+	sysfs_attrs[ATTR_UDC_STATE].path     = KOBO_USB_GADGET_STATE_MTK;
+
+	const char* interface = getenv("INTERFACE");
+	if (interface) {
+		snprintf(NET_CARRIER_SYSFS, sizeof(NET_CARRIER_SYSFS), SYSFS_ROOT "/class/net/%s/carrier", interface);
+		sysfs_attrs[ATTR_NET_CARRIER].path = NET_CARRIER_SYSFS;
+	}
+}
+
+static void
+    close_sysfs_attrs(void)
+{
+	for (SysfsAttr* attr = sysfs_attrs; attr < sysfs_attrs + ATTR_COUNT; attr++) {
+		if (attr->fd != -1) {
+			close(attr->fd);
+			attr->fd = -1;
+		}
+	}
+}
+
+// Read a sysfs attribute into buf (NUL-terminated, trailing LF stripped).
+// The fd is opened on first use and kept around: pread'ing from the start is enough for sysfs to regenerate the value,
+// which saves us an open, a stdio buffer allocation & a close on every status bar tick.
+// NOTE: This is also what re-arms POLLPRI on attributes that support sysfs_notify (e.g., the udc state).
+// Returns the amount of bytes read, or -1 on failure.
+static ssize_t
+    read_sysfs_attr(SYSFS_ATTR_E id, char* restrict buf, size_t size)
+{
+	SysfsAttr* attr = &sysfs_attrs[id];
+	buf[0]          = '\0';
+	if (!attr->path) {
+		return -1;
+	}
+
+	// NOTE: If the attribute went away in the meantime (e.g., Wi-Fi was turned off, and its module unloaded),
+	//       the stale fd will fail with ENODEV, so, try again once with a fresh one in case it's been recreated.
+	for (uint8_t i = 0U; i < 2U; i++) {
+		if (attr->fd == -1) {
+			attr->fd = open(attr->path, O_RDONLY | O_CLOEXEC);
+			if (attr->fd == -1) {
+				return -1;
+			}
+		}
+
+		ssize_t len = pread(attr->fd, buf, size - 1U, 0);
+		if (len >= 0) {
+			buf[len] = '\0';
+			// Strip trailing LF
+			if (len > 0 && buf[len - 1] == '\n') {
+				buf[len - 1] = '\0';
+			}
+			return len;
+		}
+
+		close(attr->fd);
+		attr->fd = -1;
+	}
+
+	return -1;
+}
+
 static bool
     sysfs_is_usb_plugged(int foo __attribute__((unused)), bool log_status)
 {
 	bool is_plugged = false;
 
-	FILE* f = fopen(BATT_STATUS_SYSFS, "re");
-	if (f) {
-		char   status[16] = { 0 };
-		size_t size       = fread(status, sizeof(*status), sizeof(status) - 1U, f);
-		fclose(f);
+	char    status[16] = { 0 };
+	ssize_t size       = read_sysfs_attr(ATTR_BATT_STATUS, status, sizeof(status));
+	if (size != -1) {
 		if (size > 0) {
-			// Strip trailing LF
-			if (status[size - 1U] == '\n') {
-				status[size - 1U] = '\0';
-			}
 			if (log_status) {
 				LOG(LOG_DEBUG, "Battery status: %s", status);
 			}
@@ -225,16 +351,10 @@ static bool
 {
 	bool is_plugged = false;
 
-	FILE* f = fopen(USB_ONLINE_SYSFS, "re");
-	if (f) {
-		char   status[16] = { 0 };
-		size_t size       = fread(status, sizeof(*status), sizeof(status) - 1U, f);
-		fclose(f);
+	char    status[16] = { 0 };
+	ssize_t size       = read_sysfs_attr(ATTR_USB_ONLINE, status, sizeof(status));
+	if (size != -1) {
 		if (size > 0) {
-			// Strip trailing LF
-			if (status[size - 1U] == '\n') {
-				status[size - 1U] = '\0';
-			}
 			if (log_status) {
 				LOG(LOG_DEBUG, "USB power supply online: %s", status);
 			}
@@ -265,22 +385,11 @@ static int
 		return -1;
 	}
 
-	FILE* f = fopen(USBC_PLUG_SYSFS, "re");
-	if (!f) {
+	char usbc_conn[8] = { 0 };
+	if (read_sysfs_attr(ATTR_USBC_PLUG, usbc_conn, sizeof(usbc_conn)) == -1) {
 		return -1;
 	}
-
-	bool   is_plugged   = false;
-	char   usbc_conn[8] = { 0 };
-	size_t size         = fread(usbc_conn, sizeof(*usbc_conn), sizeof(usbc_conn) - 1U, f);
-	fclose(f);
-	f = NULL;
-	if (size > 0) {
-		// Strip trailing LF
-		if (usbc_conn[size - 1U] == '\n') {
-			usbc_conn[size - 1U] = '\0';
-		}
-	}
+	bool is_plugged = false;
 
 	// Should only ever be 0 or 1
 	// NOTE: The i2c read exposes more information about what kind of device is on the other end of the cable,
@@ -380,6 +489,28 @@ static int
 	return EXIT_SUCCESS;
 }
 
+// Bump allocator for the few strings that live for the whole run (i.e., the paths the probe figures out),
+// which keeps them off the heap (c.f., USBMSArena). Returns NULL if we're out of room.
+// NOTE: Not thread-safe, but only the probe thread ever uses it, and main only reads its results once it has joined it.
+__attribute__((format(printf, 1, 2))) static char*
+    arena_printf(const char* fmt, ...)
+{
+	char*  p     = usbms_arena.buf + usbms_arena.used;
+	size_t avail = sizeof(usbms_arena.buf) - usbms_arena.used;
+
+	va_list ap;
+	va_start(ap, fmt);
+	int n = vsnprintf(p, avail, fmt, ap);
+	va_end(ap);
+	if (n < 0 || (size_t) n >= avail) {
+		PFLOG(LOG_ERR, "Ran out of arena space (%zu bytes left)", avail);
+		return NULL;
+	}
+
+	usbms_arena.used += (size_t) n + 1U;
+	return p;
+}
+
 // Pilfered from NickelMenu ;).
 // c.f., https://github.com/pgaskin/NickelMenu/blob/85cd558715886069e70cbdcb1f9de43843e49e9f/src/util.h#L14-L23
 static char*
@@ -412,6 +543,23 @@ static void
 	}
 }
 
+static void
+    timespec_add_ms(struct timespec* ts, long int ms)
+{
+	ts->tv_sec  += ms / 1000L;
+	ts->tv_nsec += (ms % 1000L) * 1000000L;
+	if (ts->tv_nsec >= 1000000000L) {
+		ts->tv_sec++;
+		ts->tv_nsec -= 1000000000L;
+	}
+}
+
+static bool
+    timespec_before(const struct timespec* a, const struct timespec* b)
+{
+	return a->tv_sec < b->tv_sec || (a->tv_sec == b->tv_sec && a->tv_nsec < b->tv_nsec);
+}
+
 static time_t
     elapsed_time(struct timespec* t2, struct timespec* t1)
 {
@@ -445,16 +593,15 @@ static uint8_t
 	uint8_t intensity = 0U;
 
 	// On Mk. 7, we can actually get it from sysfs, making our life far easier…
-	FILE* f = fopen(FL_INTENSITY_SYSFS, "re");
-	if (f) {
-		char   fl_intensity[8] = { 0 };
-		size_t size            = fread(fl_intensity, sizeof(*fl_intensity), sizeof(fl_intensity) - 1U, f);
-		fclose(f);
-		f = NULL;
+	int fd = open(FL_INTENSITY_SYSFS, O_RDONLY | O_CLOEXEC);
+	if (fd != -1) {
+		char    fl_intensity[8] = { 0 };
+		ssize_t size            = read_in_full(fd, fl_intensity, sizeof(fl_intensity) - 1U);
+		close(fd);
 		if (size > 0) {
 			// Strip trailing LF
-			if (fl_intensity[size - 1U] == '\n') {
-				fl_intensity[size - 1U] = '\0';
+			if (fl_intensity[size - 1] == '\n') {
+				fl_intensity[size - 1] = '\0';
 			}
 		}
 
@@ -478,20 +625,14 @@ static uint8_t
 	// Now, try to parse KOReader's settings…
 	char ko_settings[PATH_MAX] = { 0 };
 	snprintf(ko_settings, sizeof(ko_settings) - 1U, "%s/settings.reader.lua", ko_dir);
-	f = fopen(ko_settings, "re");
+	FILE* f = fopen(ko_settings, "re");
 	if (f) {
 		bool    found_state     = false;
 		bool    fl_state        = false;
 		bool    found_intensity = false;
 		uint8_t fl_intensity    = 0U;
-		char*   line            = NULL;
-		line                    = calloc(PIPE_BUF, sizeof(*line));
-		if (!line) {
-			PFLOG(LOG_ERR, "calloc: %m");
-			fclose(f);
-			return intensity;
-		}
-		while (fgets(line, PIPE_BUF, f)) {
+		char    line[PIPE_BUF];
+		while (fgets(line, sizeof(line), f)) {
 			char* cur_line = line;
 			if (strstr(cur_line, "[\"is_frontlight_on\"]")) {
 				char* setting_key = strsep(&cur_line, "=");
@@ -560,7 +701,6 @@ static uint8_t
 			}
 		}
 		fclose(f);
-		free(line);
 	}
 
 	return intensity;
@@ -610,74 +750,40 @@ static void
 static bool
     is_aux_battery_connected(void)
 {
-	FILE* f = fopen(CILIX_CONNECTED_SYSFS, "re");
-	if (f) {
-		char   cilix_conn[8] = { 0 };
-		size_t size          = fread(cilix_conn, sizeof(*cilix_conn), sizeof(cilix_conn) - 1U, f);
-		fclose(f);
-		f = NULL;
-		if (size > 0) {
-			// Strip trailing LF
-			if (cilix_conn[size - 1U] == '\n') {
-				cilix_conn[size - 1U] = '\0';
-			}
-		}
+	char cilix_conn[8] = { 0 };
+	read_sysfs_attr(ATTR_AUX_CONNECTED, cilix_conn, sizeof(cilix_conn));
 
-		// Check if the PowerCover is currently connected
-		if (cilix_conn[0] == '1') {
-			return true;
-		}
-	}
-
-	return false;
+	// Check if the PowerCover is currently connected
+	return cilix_conn[0] == '1';
 }
 
 // We'll want to regularly update a display of the plug/charge status, and whether Wi-Fi is on or not
+// NOTE: Gathering the data is kept separate from drawing it, so that it can be benchmarked on its own.
 static void
-    print_status(const USBMSContext* ctx)
+    get_status(const USBMSContext* ctx, USBMSStatus* status)
 {
 	// Check if we're plugged in…
-	bool usb_plugged = (*fxpIsUSBPlugged)(ctx->ntxfd, false);
+	status->usb_plugged = (*usbms_backend.is_usb_plugged)(ctx->ntxfd, false);
 
 	// Get the battery charge %
-	uint8_t batt_perc = 0U;
-	FILE*   f         = fopen(BATT_CAP_SYSFS, "re");
-	if (f) {
-		char   batt_charge[8] = { 0 };
-		size_t size           = fread(batt_charge, sizeof(*batt_charge), sizeof(batt_charge) - 1U, f);
-		fclose(f);
-		if (size > 0) {
-			// Strip trailing LF
-			if (batt_charge[size - 1U] == '\n') {
-				batt_charge[size - 1U] = '\0';
-			}
-		}
-
-		if (strtoul_hhu(batt_charge, &batt_perc) < 0) {
+	status->batt_perc   = 0U;
+	char batt_charge[8] = { 0 };
+	if (read_sysfs_attr(ATTR_BATT_CAP, batt_charge, sizeof(batt_charge)) != -1) {
+		if (strtoul_hhu(batt_charge, &status->batt_perc) < 0) {
 			PFLOG(LOG_WARNING, "Could not convert battery charge value `%s` to an uint8_t!", batt_charge);
 		}
 	}
 
 	// Check if there's a PowerCover
-	bool    has_aux_battery = false;
-	uint8_t aux_batt_perc   = 0U;
+	status->has_aux_battery = false;
+	status->aux_batt_perc   = 0U;
 	if (ctx->fbink_state.device_id == DEVICE_KOBO_SAGE) {
-		has_aux_battery = is_aux_battery_connected();
-
-		if (has_aux_battery) {
-			f = fopen(CILIX_BATT_CAP_SYSFS, "re");
-			if (f) {
-				char   cilix_charge[8] = { 0 };
-				size_t size = fread(cilix_charge, sizeof(*cilix_charge), sizeof(cilix_charge) - 1U, f);
-				fclose(f);
-				if (size > 0) {
-					// Strip trailing LF
-					if (cilix_charge[size - 1U] == '\n') {
-						cilix_charge[size - 1U] = '\0';
-					}
-				}
+		status->has_aux_battery = is_aux_battery_connected();
 
-				if (strtoul_hhu(cilix_charge, &aux_batt_perc) < 0) {
+		if (status->has_aux_battery) {
+			char cilix_charge[8] = { 0 };
+			if (read_sysfs_attr(ATTR_AUX_BATT_CAP, cilix_charge, sizeof(cilix_charge)) != -1) {
+				if (strtoul_hhu(cilix_charge, &status->aux_batt_perc) < 0) {
 					PFLOG(LOG_WARNING,
 					      "Could not convert cilix charge value `%s` to an uint8_t!",
 					      cilix_charge);
@@ -688,67 +794,149 @@ static void
 
 	// Check for Wi-Fi status
 	// (c.f., https://github.com/koreader/koreader/blob/b5d33058761625111d176123121bcc881864a64e/frontend/device/kobo/device.lua#L451-L471)
-	bool wifi_up            = false;
-	char if_sysfs[PATH_MAX] = { 0 };
-	snprintf(if_sysfs, sizeof(if_sysfs) - 1U, "/sys/class/net/%s/carrier", getenv("INTERFACE"));
-	f = fopen(if_sysfs, "re");
-	if (f) {
-		char   carrier[8] = { 0 };
-		size_t size       = fread(carrier, sizeof(*carrier), sizeof(carrier) - 1U, f);
-		fclose(f);
-		if (size > 0) {
-			// Strip trailing LF
-			if (carrier[size - 1U] == '\n') {
-				carrier[size - 1U] = '\0';
-			}
-		}
-
-		// If there's a carrier, Wi-Fi is up.
-		if (carrier[0] == '1') {
-			wifi_up = true;
-		}
-	}
+	char carrier[8] = { 0 };
+	read_sysfs_attr(ATTR_NET_CARRIER, carrier, sizeof(carrier));
+	// If there's a carrier, Wi-Fi is up.
+	status->wifi_up = carrier[0] == '1';
 
-	// Display the time
+	// And the time
 	time_t     t = time(NULL);
 	struct tm  local_tm;
-	struct tm* lt         = localtime_r(&t, &local_tm);
-	char       sz_time[6] = { 0 };
-	strftime(sz_time, sizeof(sz_time), "%H:%M", lt);
-
-	if (has_aux_battery) {
-		fbink_printf(ctx->fbfd,
-			     &ctx->ot_cfg,
-			     &ctx->fbink_cfg,
-			     NULL,
-			     "%s • \uf017 %s • %s (%hhu%%) + %s (%hhu%%) • %s",
-			     usb_plugged ? "\U000f06a5" : "\U000f06a6",
-			     sz_time,
-			     get_battery_icon(batt_perc),
-			     batt_perc,
-			     get_battery_icon(aux_batt_perc),
-			     aux_batt_perc,
-			     wifi_up ? "\U000f05a9" : "\U000f05aa");
+	struct tm* lt = localtime_r(&t, &local_tm);
+	strftime(status->sz_time, sizeof(status->sz_time), "%H:%M", lt);
+}
+
+// NOTE: Formatted on our end, as fbink_printf would heap-allocate its buffer on every redraw.
+static void
+    draw_status(const USBMSContext* ctx, const USBMSStatus* status)
+{
+	char line[128] = { 0 };
+	if (status->has_aux_battery) {
+		snprintf(line,
+			 sizeof(line),
+			 "%s • \uf017 %s • %s (%hhu%%) + %s (%hhu%%) • %s",
+			 status->usb_plugged ? "\U000f06a5" : "\U000f06a6",
+			 status->sz_time,
+			 get_battery_icon(status->batt_perc),
+			 status->batt_perc,
+			 get_battery_icon(status->aux_batt_perc),
+			 status->aux_batt_perc,
+			 status->wifi_up ? "\U000f05a9" : "\U000f05aa");
 	} else {
-		fbink_printf(ctx->fbfd,
-			     &ctx->ot_cfg,
-			     &ctx->fbink_cfg,
-			     NULL,
-			     "%s • \uf017 %s • %s (%hhu%%) • %s",
-			     usb_plugged ? "\U000f06a5" : "\U000f06a6",
-			     sz_time,
-			     get_battery_icon(batt_perc),
-			     batt_perc,
-			     wifi_up ? "\U000f05a9" : "\U000f05aa");
+		snprintf(line,
+			 sizeof(line),
+			 "%s • \uf017 %s • %s (%hhu%%) • %s",
+			 status->usb_plugged ? "\U000f06a5" : "\U000f06a6",
+			 status->sz_time,
+			 get_battery_icon(status->batt_perc),
+			 status->batt_perc,
+			 status->wifi_up ? "\U000f05a9" : "\U000f05aa");
+	}
+	fbink_print_ot(ctx->fbfd, line, &ctx->ot_cfg, &ctx->fbink_cfg, NULL);
+}
+
+// Flags the fields that differ between two status snapshots (i.e., 0 if they'd render the same)
+static int
+    diff_status(const USBMSStatus* a, const USBMSStatus* b)
+{
+	int changed = 0;
+	if (a->usb_plugged != b->usb_plugged) {
+		changed |= STATUS_FIELD_PLUG;
+	}
+	if (strcmp(a->sz_time, b->sz_time) != 0) {
+		changed |= STATUS_FIELD_TIME;
+	}
+	if (a->batt_perc != b->batt_perc) {
+		changed |= STATUS_FIELD_BATT;
+	}
+	if (a->has_aux_battery != b->has_aux_battery || a->aux_batt_perc != b->aux_batt_perc) {
+		changed |= STATUS_FIELD_AUX_BATT;
+	}
+	if (a->wifi_up != b->wifi_up) {
+		changed |= STATUS_FIELD_WIFI;
+	}
+	return changed;
+}
+
+static void
+    print_status(USBMSContext* ctx)
+{
+	USBMSStatus status = { 0 };
+	get_status(ctx, &status);
+
+	// NOTE: Every redraw costs us an EPDC update, so, don't bother if nothing we display has actually changed
+	//       (which is fairly common on power_supply uevents, as those fire for a lot more than just the capacity).
+	//       We can't do much better than that on a field by field basis, though: this is a single centered line,
+	//       so any change in width shifts every field anyway (and FBInk only refreshes that line to begin with).
+	if (ctx->status_drawn) {
+		int changed = diff_status(&ctx->status, &status);
+		if (changed == 0) {
+			LOG(LOG_DEBUG, "Status bar is up to date, skipping redraw");
+			return;
+		}
+		LOG(LOG_DEBUG, "Redrawing status bar (changed fields: 0x%02X)", (unsigned int) changed);
 	}
+
+	draw_status(ctx, &status);
+	ctx->status       = status;
+	ctx->status_drawn = true;
 }
 
+// NOTE: At font_h * 30, the icons are by far the most expensive thing we rasterize,
+//       and we only ever cycle through a handful of them (mainly plugged/unplugged while waiting for a plug in).
+//       So, dump what the first render actually drew, and blit that back (via FBInk, which handles every fb bpp)
+//       the next time we're asked for the same icon.
+//       Keyed by string & inversion state, since a fake nightmode flips the pixels themselves.
 static void
     print_icon(const char* string, USBMSContext* ctx)
 {
+	USBMSIcon* icon = NULL;
+	for (USBMSIcon* slot = ctx->icons; slot < ctx->icons + ICON_CACHE_SIZE; slot++) {
+		if (slot->string && slot->is_inverted == ctx->fbink_cfg.is_inverted && strcmp(slot->string, string) == 0) {
+			icon = slot;
+			break;
+		}
+	}
+	if (icon) {
+		if (fbink_restore(ctx->fbfd, &ctx->fbink_cfg, &icon->dump) == EXIT_SUCCESS) {
+			return;
+		}
+		// Something changed under our feet (e.g., rotation), render it again, and refresh the cached copy
+		LOG(LOG_WARNING, "Failed to restore cached icon, rendering it again");
+	} else {
+		// Evict the oldest entry
+		icon           = &ctx->icons[ctx->next_icon];
+		ctx->next_icon = (uint8_t) ((ctx->next_icon + 1U) % ICON_CACHE_SIZE);
+	}
+
 	ctx->fbink_cfg.is_halfway = true;
-	fbink_print_ot(ctx->fbfd, string, &ctx->icon_cfg, &ctx->fbink_cfg, NULL);
+	int rc                    = fbink_print_ot(ctx->fbfd, string, &ctx->icon_cfg, &ctx->fbink_cfg, NULL);
 	ctx->fbink_cfg.is_halfway = false;
+
+	if (icon->dump.data) {
+		fbink_free_dump_data(&icon->dump);
+	}
+	icon->string = NULL;
+	if (rc < 0) {
+		return;
+	}
+	// NOTE: We want the rect in the fb's own layout, which is what fbink_rect_dump expects
+	const FBInkRect rect = fbink_get_last_rect(true);
+	if (fbink_rect_dump(ctx->fbfd, &rect, &icon->dump) == EXIT_SUCCESS) {
+		icon->string      = string;
+		icon->is_inverted = ctx->fbink_cfg.is_inverted;
+	}
+}
+
+static void
+    free_icon_cache(USBMSContext* ctx)
+{
+	for (USBMSIcon* icon = ctx->icons; icon < ctx->icons + ICON_CACHE_SIZE; icon++) {
+		if (icon->dump.data) {
+			fbink_free_dump_data(&icon->dump);
+		}
+		icon->string = NULL;
+	}
 }
 
 static int
@@ -757,6 +945,51 @@ static int
 	return fbink_print_ot(ctx->fbfd, string, &ctx->msg_cfg, &ctx->fbink_cfg, NULL);
 }
 
+// Print the fuser script's output, one line after the other
+static void
+    print_fuser_line(const char* line, void* data)
+{
+	USBMSContext* ctx        = data;
+	int           rc         = print_msg(line, ctx);
+	ctx->msg_cfg.margins.top = (short int) rc;
+}
+
+// Human-readable names for the phases our scripts report (c.f., USBMS_PROGRESS_FD)
+static const char*
+    progress_phase_label(const char* phase)
+{
+	if (strcmp(phase, "sync") == 0) {
+		return _("Flushing to disk");
+	} else if (strcmp(phase, "umount") == 0) {
+		return _("Unmounting");
+	} else if (strcmp(phase, "usb") == 0) {
+		return _("Configuring USB");
+	} else if (strcmp(phase, "fsck") == 0) {
+		return _("Checking filesystem");
+	} else if (strcmp(phase, "mount") == 0) {
+		return _("Mounting");
+	}
+	// Unknown phases are printed as-is
+	return phase;
+}
+
+// Print a script's progress under the current message
+static void
+    print_progress(const char* phase, uint8_t pct, void* data)
+{
+	USBMSProgress* progress = data;
+	// Nothing new, nothing to print
+	if (progress->pct == pct && strcmp(progress->phase, phase) == 0) {
+		return;
+	}
+	snprintf(progress->phase, sizeof(progress->phase), "%s", phase);
+	progress->pct = pct;
+
+	USBMSContext* ctx = progress->ctx;
+	fbink_printf(
+	    ctx->fbfd, &ctx->msg_cfg, &ctx->fbink_cfg, NULL, "%s\n%s (%hhu%%)", progress->msg, progress_phase_label(phase), pct);
+}
+
 static int
     print_countdown(time_t left, USBMSContext* ctx)
 {
@@ -798,98 +1031,737 @@ static int
 	return fbink_print_ot(ctx->fbfd, " ", &ctx->countdown_cfg, &ctx->fbink_cfg, NULL);
 }
 
-// Poor man's grep in /proc/modules
-__attribute((nonnull(1))) static bool
-    is_module_loaded(const char* needle)
+static void
+    reactor_close(USBMSReactor* reactor)
 {
-	FILE* f = fopen("/proc/modules", "re");
-	if (f) {
-		char   line[PIPE_BUF];
-		size_t len = strlen(needle);
-		while (fgets(line, sizeof(line), f)) {
-			if (strncmp(line, needle, len) == 0) {
-				fclose(f);
-				return true;
-			}
+	for (size_t i = 0U; i < REACTOR_CLOCKS; i++) {
+		if (reactor->clocks[i].tfd != -1) {
+			close(reactor->clocks[i].tfd);
+			reactor->clocks[i].tfd = -1;
 		}
-		fclose(f);
 	}
+	if (reactor->epfd != -1) {
+		close(reactor->epfd);
+		reactor->epfd = -1;
+	}
+}
 
-	return false;
+static USBMSReactorClock*
+    reactor_clock(USBMSReactor* reactor, clockid_t id)
+{
+	return &reactor->clocks[id == CLOCK_REALTIME ? REACTOR_CLOCK_REALTIME : REACTOR_CLOCK_MONOTONIC];
 }
 
-// Parse an evdev event, looking for a power button press
-static bool
-    handle_evdev(struct libevdev* dev)
+// Arm rclock's timerfd for its earliest deadline (or disarm it if it doesn't have any timers left)
+static void
+    reactor_arm(USBMSReactor* reactor, USBMSReactorClock* rclock)
 {
-	int rc = 1;
-	do {
-		struct input_event ev;
-		rc = libevdev_next_event(dev, LIBEVDEV_READ_FLAG_NORMAL, &ev);
-		if (rc == LIBEVDEV_READ_STATUS_SYNC) {
-			while (rc == LIBEVDEV_READ_STATUS_SYNC) {
-				// NOTE: We're ignoring the sync delta events here.
-				rc = libevdev_next_event(dev, LIBEVDEV_READ_FLAG_SYNC, &ev);
-			}
-		} else if (rc == LIBEVDEV_READ_STATUS_SUCCESS) {
-			// Check if it's a power button press (well, release, actually)
-			if (libevdev_event_is_code(&ev, EV_KEY, KEY_POWER) == 1 && ev.value == 0) {
-				return true;
-			}
+	struct itimerspec its = { 0 };
+	for (size_t i = 0U; i < REACTOR_MAX_TIMERS; i++) {
+		const USBMSReactorTimer* timer = &reactor->timers[i];
+		if (!timer->cb || timer->clock != rclock->id) {
+			continue;
+		}
+		if ((its.it_value.tv_sec == 0 && its.it_value.tv_nsec == 0) ||
+		    timespec_before(&timer->deadline, &its.it_value)) {
+			its.it_value = timer->deadline;
 		}
-	} while (rc == LIBEVDEV_READ_STATUS_SYNC || rc == LIBEVDEV_READ_STATUS_SUCCESS);
-	if (rc != LIBEVDEV_READ_STATUS_SUCCESS && rc != -EAGAIN) {
-		PFLOG(LOG_ERR, "Failed to handle input events: %s", strerror(-rc));
 	}
 
-	return false;
+	// Don't bother the kernel if nothing changed (e.g., after a periodic tick, when another timer is due first)
+	if (its.it_value.tv_sec == rclock->armed.tv_sec && its.it_value.tv_nsec == rclock->armed.tv_nsec) {
+		return;
+	}
+	if (timerfd_settime(rclock->tfd, TFD_TIMER_ABSTIME, &its, NULL) == -1) {
+		PFLOG(LOG_ERR, "timerfd_settime: %m");
+		return;
+	}
+	rclock->armed = its.it_value;
 }
 
-// Parse an evdev event, looking for a SW_DOCK switch
+// Fire every timer of that clock that's due
 static int
-    handle_usbc_evdev(struct libevdev* dev)
+    reactor_fire_timers(USBMSReactor* reactor, int fd, uint32_t events __attribute__((unused)), void* data)
 {
-	int rc = 1;
-	do {
-		struct input_event ev;
-		rc = libevdev_next_event(dev, LIBEVDEV_READ_FLAG_NORMAL, &ev);
-		if (rc == LIBEVDEV_READ_STATUS_SYNC) {
-			while (rc == LIBEVDEV_READ_STATUS_SYNC) {
-				// NOTE: We're ignoring the sync delta events here.
-				rc = libevdev_next_event(dev, LIBEVDEV_READ_FLAG_SYNC, &ev);
-			}
-		} else if (rc == LIBEVDEV_READ_STATUS_SUCCESS) {
-			// If it's a SW_DOCK switch, return the value
-			if (libevdev_event_is_code(&ev, EV_SW, SW_DOCK) == 1) {
-				LOG(LOG_NOTICE, "Caught a USB-C plug %s event", ev.value ? "in" : "out");
-				return ev.value;
+	USBMSReactorClock* rclock = data;
+	// We don't actually care about the expiration count, so just read to clear the event
+	uint64_t           exp;
+	ssize_t            nr = read(fd, &exp, sizeof(exp));
+	if (nr != (ssize_t) sizeof(exp)) {
+		// NOTE: EAGAIN means it was re-armed (e.g., by an earlier callback in this batch) since epoll_wait woke us up,
+		//       so it isn't actually due yet.
+		if (nr == -1 && errno != EAGAIN) {
+			PFLOG(LOG_WARNING, "read: %m");
+		}
+		return REACTOR_CONTINUE;
+	}
+	// It's now disarmed, in any case
+	rclock->armed = (struct timespec){ 0 };
+
+	struct timespec now = { 0 };
+	clock_gettime(rclock->id, &now);
+	int rc = REACTOR_CONTINUE;
+	for (size_t i = 0U; i < REACTOR_MAX_TIMERS && rc == REACTOR_CONTINUE; i++) {
+		USBMSReactorTimer* timer = &reactor->timers[i];
+		if (!timer->cb || timer->clock != rclock->id || timespec_before(&now, &timer->deadline)) {
+			continue;
+		}
+
+		USBMSReactorTimerCb cb      = timer->cb;
+		void*               cb_data = timer->data;
+		if (timer->interval_ms > 0L) {
+			// NOTE: Like a timerfd, we only fire once for however many expirations we might have missed
+			//       (e.g., if the wall clock jumped forward).
+			while (!timespec_before(&now, &timer->deadline)) {
+				timespec_add_ms(&timer->deadline, timer->interval_ms);
 			}
+		} else {
+			// One-shot, free the slot *before* the callback, so that it can re-arm itself
+			timer->cb = NULL;
 		}
-	} while (rc == LIBEVDEV_READ_STATUS_SYNC || rc == LIBEVDEV_READ_STATUS_SUCCESS);
-	if (rc != LIBEVDEV_READ_STATUS_SUCCESS && rc != -EAGAIN) {
-		PFLOG(LOG_ERR, "Failed to handle input events: %s", strerror(-rc));
+		rc = (*cb)(reactor, cb_data);
 	}
+	reactor_arm(reactor, rclock);
 
-	return -1;
+	return rc;
 }
 
-// Parse an uevent
+// Call cb whenever fd reports events. Negative fds are silently skipped (for optional devices).
 static int
-    handle_uevent(struct uevent_listener* l, struct uevent* uevp)
+    reactor_add(USBMSReactor* reactor, int fd, uint32_t events, USBMSReactorFdCb cb, void* data)
 {
-	ue_reset_event(uevp);
-	ssize_t len = xread(l->pfd.fd, uevp->buf, sizeof(uevp->buf) - 1U);
-	if (len == -1) {
-		if (errno == ENOBUFS) {
-			// NOTE: Unlike ue_wait_for_event, don't recover:
-			//       since events were most likely lost, we'll consider this fatal
-			PFLOG(LOG_WARNING, "uevent overrun!");
-		}
-		PFLOG(LOG_CRIT, "read: %m");
-		return ERR_LISTENER_RECV;
+	if (fd < 0) {
+		return 0;
 	}
-	char* end = uevp->buf + len;
-	*end      = '\0';
+
+	for (size_t i = 0U; i < REACTOR_MAX_SOURCES; i++) {
+		USBMSReactorSource* src = &reactor->sources[i];
+		if (src->fd != -1) {
+			continue;
+		}
+
+		struct epoll_event ev = { .events = events, .data.ptr = src };
+		if (epoll_ctl(reactor->epfd, EPOLL_CTL_ADD, fd, &ev) == -1) {
+			PFLOG(LOG_ERR, "epoll_ctl: %m");
+			return -1;
+		}
+		src->fd   = fd;
+		src->cb   = cb;
+		src->data = data;
+		return 0;
+	}
+
+	PFLOG(LOG_ERR, "No room left for fd %d", fd);
+	return -1;
+}
+
+static void
+    reactor_del(USBMSReactor* reactor, int fd)
+{
+	if (fd < 0) {
+		return;
+	}
+
+	for (size_t i = 0U; i < REACTOR_MAX_SOURCES; i++) {
+		USBMSReactorSource* src = &reactor->sources[i];
+		if (src->fd == fd) {
+			// NOTE: This fails if the fd has already been closed, which is fine, as that took it out of the set.
+			epoll_ctl(reactor->epfd, EPOLL_CTL_DEL, fd, &(struct epoll_event){ 0 });
+			src->fd = -1;
+		}
+	}
+}
+
+static int
+    reactor_init(USBMSReactor* reactor)
+{
+	for (size_t i = 0U; i < REACTOR_MAX_SOURCES; i++) {
+		reactor->sources[i].fd = -1;
+	}
+	for (size_t i = 0U; i < REACTOR_MAX_TIMERS; i++) {
+		reactor->timers[i].cb = NULL;
+	}
+	// NOTE: Relative deadlines (timeouts, countdowns) shouldn't be thrown off by the wall clock being set
+	//       (e.g., by ntpd, or by our own eject timestamp fixup), only the status bar's clock cares about it.
+	reactor->clocks[REACTOR_CLOCK_MONOTONIC] = (USBMSReactorClock){ .id = CLOCK_MONOTONIC, .tfd = -1 };
+	reactor->clocks[REACTOR_CLOCK_REALTIME]  = (USBMSReactorClock){ .id = CLOCK_REALTIME, .tfd = -1 };
+
+	reactor->epfd = epoll_create1(EPOLL_CLOEXEC);
+	if (reactor->epfd == -1) {
+		PFLOG(LOG_CRIT, "epoll_create1: %m");
+		return -1;
+	}
+	for (size_t i = 0U; i < REACTOR_CLOCKS; i++) {
+		USBMSReactorClock* rclock = &reactor->clocks[i];
+		rclock->tfd               = timerfd_create(rclock->id, TFD_NONBLOCK | TFD_CLOEXEC);
+		if (rclock->tfd == -1) {
+			PFLOG(LOG_CRIT, "timerfd_create: %m");
+			reactor_close(reactor);
+			return -1;
+		}
+		if (reactor_add(reactor, rclock->tfd, EPOLLIN, &reactor_fire_timers, rclock) == -1) {
+			reactor_close(reactor);
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+// Call cb once first (an absolute time on clock_id) comes around, then every interval_ms if it's non-zero.
+// Returns the timer's id (c.f., reactor_del_timer), or -1 if we're out of slots.
+static int
+    reactor_add_timer(USBMSReactor*          reactor,
+		      clockid_t              clock_id,
+		      const struct timespec* first,
+		      long int               interval_ms,
+		      USBMSReactorTimerCb    cb,
+		      void*                  data)
+{
+	for (size_t i = 0U; i < REACTOR_MAX_TIMERS; i++) {
+		USBMSReactorTimer* timer = &reactor->timers[i];
+		if (timer->cb) {
+			continue;
+		}
+
+		timer->clock       = clock_id;
+		timer->deadline    = *first;
+		timer->interval_ms = interval_ms;
+		timer->cb          = cb;
+		timer->data        = data;
+		reactor_arm(reactor, reactor_clock(reactor, clock_id));
+		return (int) i;
+	}
+
+	PFLOG(LOG_ERR, "No room left for another timer");
+	return -1;
+}
+
+// Ditto, but relative to now, on the monotonic clock (i.e., for timeouts)
+static int
+    reactor_add_timeout(USBMSReactor*       reactor,
+			long int            delay_ms,
+			long int            interval_ms,
+			USBMSReactorTimerCb cb,
+			void*               data)
+{
+	struct timespec first = { 0 };
+	clock_gettime(CLOCK_MONOTONIC, &first);
+	timespec_add_ms(&first, delay_ms);
+	return reactor_add_timer(reactor, CLOCK_MONOTONIC, &first, interval_ms, cb, data);
+}
+
+static void
+    reactor_del_timer(USBMSReactor* reactor, int id)
+{
+	if (id < 0) {
+		return;
+	}
+
+	reactor->timers[id].cb = NULL;
+	reactor_arm(reactor, reactor_clock(reactor, reactor->timers[id].clock));
+}
+
+// Dispatch events to their callbacks until one of them asks us to stop.
+// Returns whatever it returned, or -1 if epoll_wait failed.
+// NOTE: Everything is level-triggered, so whatever was left unhandled when we stopped will still be there next time.
+static int
+    reactor_run(USBMSReactor* reactor)
+{
+	while (true) {
+		struct epoll_event events[REACTOR_MAX_EVENTS];
+		int                n = epoll_wait(reactor->epfd, events, REACTOR_MAX_EVENTS, -1);
+		if (n == -1) {
+			if (errno == EINTR) {
+				continue;
+			}
+			PFLOG(LOG_CRIT, "epoll_wait: %m");
+			return -1;
+		}
+
+		for (int i = 0; i < n; i++) {
+			const USBMSReactorSource* src = events[i].data.ptr;
+			// NOTE: An earlier callback in this batch may have dropped it, hence the fd check
+			if (src->fd == -1) {
+				continue;
+			}
+			int rc = (*src->cb)(reactor, src->fd, events[i].events, src->data);
+			if (rc != REACTOR_CONTINUE) {
+				return rc;
+			}
+		}
+	}
+}
+
+// Stop reactor_run (c.f., reactor_sleep)
+static int
+    reactor_stop(USBMSReactor* reactor __attribute__((unused)), void* data __attribute__((unused)))
+{
+	return WAIT_TIMER;
+}
+
+// Sleep for a while, while keeping everything that's still registered (i.e., the status bar) ticking.
+// Returns WAIT_TIMER once we're done sleeping, or whatever else stopped reactor_run first (c.f., reactor_run).
+static int
+    reactor_sleep(USBMSReactor* reactor, long int ms)
+{
+	int id = reactor ? reactor_add_timeout(reactor, ms, 0L, &reactor_stop, NULL) : -1;
+	if (id == -1) {
+		const struct timespec zzz = { ms / 1000L, (ms % 1000L) * 1000000L };
+		nanosleep(&zzz, NULL);
+		return WAIT_TIMER;
+	}
+	// NOTE: Some other callback may stop us first, in which case, make sure we don't leave our timer behind
+	int rc = reactor_run(reactor);
+	if (rc != WAIT_TIMER) {
+		reactor_del_timer(reactor, id);
+	}
+	return rc;
+}
+
+// Hand a single line from the child over to the right callback (or syslog)
+static void
+    handle_child_line(const USBMSChild* child, bool progress, const char* line)
+{
+	if (progress) {
+		// NOTE: Keep the field width in sync with USBMS_PROGRESS_PHASE_LEN
+		char         phase[USBMS_PROGRESS_PHASE_LEN] = { 0 };
+		unsigned int pct                             = 0U;
+		if (sscanf(line, "PHASE %31s %u%%", phase, &pct) != 2 || pct > 100U) {
+			LOG(LOG_WARNING, "[%s] Malformed progress report: `%s`", child->name, line);
+			return;
+		}
+		LOG(LOG_INFO, "[%s] Phase %s: %u%%", child->name, phase, pct);
+		(*child->on_progress)(phase, (uint8_t) pct, child->data);
+	} else if (child->on_line) {
+		(*child->on_line)(line, child->data);
+	} else {
+		LOG(LOG_INFO, "[%s] %s", child->name, line);
+	}
+}
+
+// Hand over every complete line accumulated in buf (from the child's output, or its progress pipe),
+// and keep the remainder for later. If flush is set, the remainder is handed over, too.
+static void
+    handle_child_output(const USBMSChild* child, bool progress, char* buf, size_t* len, bool flush)
+{
+	char* line = buf;
+	char* eol  = NULL;
+	while ((eol = memchr(line, '\n', *len - (size_t) (line - buf)))) {
+		*eol = '\0';
+		handle_child_line(child, progress, line);
+		line = eol + 1;
+	}
+	*len -= (size_t) (line - buf);
+	memmove(buf, line, *len);
+
+	if (flush && *len > 0U) {
+		buf[*len] = '\0';
+		handle_child_line(child, progress, buf);
+		*len = 0U;
+	}
+}
+
+// Drain whatever's available on one of the child's pipes. Returns false on EOF (or error).
+static bool
+    read_child_output(const USBMSChild* child, bool progress, int fd, char* buf, size_t size, size_t* len)
+{
+	while (true) {
+		ssize_t nread = read(fd, buf + *len, size - 1U - *len);
+		if (nread == -1) {
+			if (errno == EINTR) {
+				continue;
+			}
+			return errno == EAGAIN;
+		} else if (nread == 0) {
+			return false;
+		}
+		*len += (size_t) nread;
+		// Don't let a very long line wedge us
+		handle_child_output(child, progress, buf, len, *len == size - 1U);
+	}
+}
+
+// Drain one of the child's pipes (c.f., run_child)
+static int
+    on_child_output(USBMSReactor* reactor, int fd, uint32_t events __attribute__((unused)), void* data)
+{
+	USBMSChildRun* run = data;
+	bool           alive    = false;
+	bool           progress = fd == run->progfd;
+	if (progress) {
+		alive = read_child_output(run->child, true, fd, run->pbuf, sizeof(run->pbuf), &run->plen);
+	} else {
+		alive = read_child_output(run->child, false, fd, run->buf, sizeof(run->buf), &run->len);
+	}
+	if (!alive) {
+		// EOF, stop watching it
+		reactor_del(reactor, fd);
+		if (progress) {
+			run->progfd = -1;
+		} else {
+			run->outfd = -1;
+		}
+	}
+	return REACTOR_CONTINUE;
+}
+
+// Drain a SIGCHLD signalfd, and check whether pid is done (in which case its wait status is stored in status)
+static bool
+    reap_child(int sfd, pid_t pid, int* status)
+{
+	struct signalfd_siginfo si;
+	while (read(sfd, &si, sizeof(si)) == sizeof(si)) {
+		;
+	}
+	// NOTE: SIGCHLD may have been about some other child of ours, so, check that it's actually the right one
+	return waitpid(pid, status, WNOHANG) == pid;
+}
+
+static int
+    on_child_exit(USBMSReactor* reactor __attribute__((unused)),
+		  int           fd,
+		  uint32_t      events __attribute__((unused)),
+		  void*         data)
+{
+	USBMSChildRun* run = data;
+	return reap_child(fd, run->pid, &run->status) ? WAIT_CHILD : REACTOR_CONTINUE;
+}
+
+static int
+    on_child_timeout(USBMSReactor* reactor, void* data)
+{
+	USBMSChildRun* run = data;
+	run->timer         = -1;
+	if (!run->killed) {
+		LOG(LOG_WARNING,
+		    "%s timed out after %ld sec, killing it",
+		    run->child->name,
+		    (long int) run->child->timeout);
+		kill(-run->pid, SIGTERM);
+		run->killed = true;
+		// And if it's still around after a grace period, don't ask nicely anymore
+		run->timer = reactor_add_timeout(reactor, USBMS_CHILD_KILL_GRACE * 1000L, 0L, &on_child_timeout, run);
+	} else {
+		kill(-run->pid, SIGKILL);
+	}
+	return REACTOR_CONTINUE;
+}
+
+// Run a child process (without a shell), without freezing the UI:
+// the status bar keeps ticking while it runs (c.f., spawn_ui), its stdout & stderr are streamed to syslog
+// (or to child->on_line), and it's killed (along with its own children) if it outlives child->timeout.
+// If child->on_progress is set, its progress reports (c.f., USBMS_PROGRESS_FD) are forwarded there as they come in.
+// NOTE: Completion is reported through a signalfd, because pidfds are much too recent for our kernels.
+//       Everything is dispatched through a reactor (c.f., reactor_run), including the timeout.
+// Returns its wait status (like system), or -1 if it couldn't be spawned.
+static int
+    run_child(const USBMSChild* child)
+{
+	int                        status       = -1;
+	int                        sfd          = -1;
+	int                        pipefd[2]    = { -1, -1 };
+	int                        progfd[2]    = { -1, -1 };
+	char**                     envp         = environ;
+	bool                       has_actions  = false;
+	bool                       has_attr     = false;
+	posix_spawn_file_actions_t actions;
+	posix_spawnattr_t          attr;
+
+	// Block SIGCHLD so we can get it through a signalfd instead
+	sigset_t mask;
+	sigset_t old_mask;
+	sigemptyset(&mask);
+	sigaddset(&mask, SIGCHLD);
+	sigprocmask(SIG_BLOCK, &mask, &old_mask);
+	sfd = signalfd(-1, &mask, SFD_NONBLOCK | SFD_CLOEXEC);
+	if (sfd == -1) {
+		PFLOG(LOG_WARNING, "signalfd: %m");
+		goto cleanup;
+	}
+
+	// NOTE: Only our end should be non-blocking
+	if (pipe2(pipefd, O_CLOEXEC) == -1) {
+		PFLOG(LOG_WARNING, "pipe2: %m");
+		goto cleanup;
+	}
+	fcntl(pipefd[0], F_SETFL, O_NONBLOCK);
+
+	// Ditto for the progress pipe, if any
+	char progress_env[32] = { 0 };
+	if (child->on_progress) {
+		if (pipe2(progfd, O_CLOEXEC) == -1) {
+			PFLOG(LOG_WARNING, "pipe2: %m");
+			goto cleanup;
+		}
+		fcntl(progfd[0], F_SETFL, O_NONBLOCK);
+		// NOTE: Make sure the write end isn't already USBMS_PROGRESS_FD itself,
+		//       as dup2'ing an fd onto itself wouldn't clear its CLOEXEC flag on older glibcs.
+		int fd = fcntl(progfd[1], F_DUPFD_CLOEXEC, USBMS_PROGRESS_FD + 1);
+		if (fd == -1) {
+			PFLOG(LOG_WARNING, "fcntl: %m");
+			goto cleanup;
+		}
+		close(progfd[1]);
+		progfd[1] = fd;
+
+		// Let it know where to write, on top of our own env
+		size_t n = 0U;
+		while (environ[n]) {
+			n++;
+		}
+		envp = calloc(n + 2U, sizeof(*envp));
+		if (!envp) {
+			PFLOG(LOG_WARNING, "calloc: %m");
+			goto cleanup;
+		}
+		snprintf(progress_env, sizeof(progress_env), "USBMS_PROGRESS_FD=%d", USBMS_PROGRESS_FD);
+		size_t i = 0U;
+		envp[i++] = progress_env;
+		for (char** env = environ; *env; env++) {
+			if (strncmp(*env, "USBMS_PROGRESS_FD=", sizeof("USBMS_PROGRESS_FD=") - 1U) != 0) {
+				envp[i++] = *env;
+			}
+		}
+	}
+
+	int rc = posix_spawn_file_actions_init(&actions);
+	if (rc != 0) {
+		errno = rc;
+		PFLOG(LOG_WARNING, "posix_spawn_file_actions_init: %m");
+		goto cleanup;
+	}
+	has_actions = true;
+	posix_spawn_file_actions_addopen(&actions, STDIN_FILENO, "/dev/null", O_RDONLY, 0);
+	posix_spawn_file_actions_adddup2(&actions, pipefd[1], STDOUT_FILENO);
+	posix_spawn_file_actions_adddup2(&actions, pipefd[1], STDERR_FILENO);
+	if (progfd[1] != -1) {
+		posix_spawn_file_actions_adddup2(&actions, progfd[1], USBMS_PROGRESS_FD);
+	}
+
+	rc = posix_spawnattr_init(&attr);
+	if (rc != 0) {
+		errno = rc;
+		PFLOG(LOG_WARNING, "posix_spawnattr_init: %m");
+		goto cleanup;
+	}
+	has_attr = true;
+	// In its own process group, so that a timeout takes down its whole tree, and with our original signal mask
+	// NOTE: Minus SIGCHLD, in case it was already blocked on our end (c.f., probe_device)
+	sigset_t child_mask = old_mask;
+	sigdelset(&child_mask, SIGCHLD);
+	short int flags = POSIX_SPAWN_SETPGROUP | POSIX_SPAWN_SETSIGMASK;
+#ifdef POSIX_SPAWN_USEVFORK
+	// Don't bother duplicating our page tables just to exec (newer glibcs always do that anyway)
+	flags |= POSIX_SPAWN_USEVFORK;
+#endif
+	posix_spawnattr_setflags(&attr, flags);
+	posix_spawnattr_setpgroup(&attr, 0);
+	posix_spawnattr_setsigmask(&attr, &child_mask);
+
+	// NOTE: posix_spawn's prototype is stuck with a non-const argv, but it doesn't actually touch it
+	char* argv[USBMS_CHILD_MAX_ARGS + 1U];
+	memcpy(argv, child->argv, sizeof(argv));
+	pid_t pid = -1;
+	rc        = posix_spawnp(&pid, argv[0], &actions, &attr, argv, envp);
+	close(pipefd[1]);
+	pipefd[1] = -1;
+	if (progfd[1] != -1) {
+		close(progfd[1]);
+		progfd[1] = -1;
+	}
+	if (rc != 0) {
+		errno = rc;
+		LOG(LOG_WARNING, "Could not run %s: posix_spawnp: %m", child->name);
+		goto cleanup;
+	}
+	LOG(LOG_DEBUG, "Spawned %s (pid: %d)", child->name, pid);
+
+	// NOTE: Keep the status bar ticking on the main reactor if the UI is up,
+	//       otherwise (e.g., on the probe thread, which runs before that), use one of our own.
+	USBMSReactor  own_reactor = REACTOR_INITIALIZER;
+	USBMSReactor* reactor     = spawn_ui.reactor;
+	if (!reactor && reactor_init(&own_reactor) == 0) {
+		reactor = &own_reactor;
+	}
+
+	USBMSChildRun run = { .child = child, .pid = pid, .outfd = pipefd[0], .progfd = progfd[0], .timer = -1 };
+	if (reactor && child->timeout > 0) {
+		run.timer = reactor_add_timeout(reactor, (long int) child->timeout * 1000L, 0L, &on_child_timeout, &run);
+	}
+	if (!reactor || reactor_add(reactor, sfd, EPOLLIN, &on_child_exit, &run) == -1 ||
+	    reactor_add(reactor, run.outfd, EPOLLIN, &on_child_output, &run) == -1 ||
+	    reactor_add(reactor, run.progfd, EPOLLIN, &on_child_output, &run) == -1 ||
+	    reactor_run(reactor) != WAIT_CHILD) {
+		// Can't do much else than wait for it, then
+		waitpid(pid, &status, 0);
+	} else {
+		status = run.status;
+	}
+	if (reactor) {
+		reactor_del(reactor, sfd);
+		reactor_del(reactor, run.outfd);
+		reactor_del(reactor, run.progfd);
+		reactor_del_timer(reactor, run.timer);
+		reactor_close(&own_reactor);
+	}
+
+	// Whatever's still in the pipe
+	// NOTE: We don't wait for EOF, as something it launched in the background might be holding on to the pipe.
+	if (run.outfd != -1) {
+		read_child_output(child, false, run.outfd, run.buf, sizeof(run.buf), &run.len);
+	}
+	handle_child_output(child, false, run.buf, &run.len, true);
+	if (run.progfd != -1) {
+		read_child_output(child, true, run.progfd, run.pbuf, sizeof(run.pbuf), &run.plen);
+	}
+	handle_child_output(child, true, run.pbuf, &run.plen, true);
+
+	if (WIFEXITED(status)) {
+		LOG(WEXITSTATUS(status) == EXIT_SUCCESS ? LOG_DEBUG : LOG_WARNING,
+		    "%s exited with status %d",
+		    child->name,
+		    WEXITSTATUS(status));
+	} else if (WIFSIGNALED(status)) {
+		LOG(LOG_WARNING, "%s was terminated by signal %s", child->name, strsignal(WTERMSIG(status)));
+	}
+
+cleanup:
+	if (has_attr) {
+		posix_spawnattr_destroy(&attr);
+	}
+	if (has_actions) {
+		posix_spawn_file_actions_destroy(&actions);
+	}
+	for (size_t i = 0U; i < 2U; i++) {
+		if (pipefd[i] != -1) {
+			close(pipefd[i]);
+		}
+		if (progfd[i] != -1) {
+			close(progfd[i]);
+		}
+	}
+	if (envp != environ) {
+		free(envp);
+	}
+	if (sfd != -1) {
+		close(sfd);
+	}
+	sigprocmask(SIG_SETMASK, &old_mask, NULL);
+
+	return status;
+}
+
+// Load one of our fonts, preferring its build-time subset if we shipped one (c.f., tools/subset_fonts.py)
+__attribute__((nonnull)) static int
+    add_ot_font(const char* abs_pwd, const char* subset, const char* font, FBInkOTConfig* cfg)
+{
+	char path[PATH_MAX] = { 0 };
+	snprintf(path, sizeof(path) - 1U, "%s/resources/fonts/%s", abs_pwd, subset);
+	if (access(path, F_OK) == 0) {
+		if (fbink_add_ot_font_v2(path, FNT_REGULAR, cfg) == EXIT_SUCCESS) {
+			LOG(LOG_INFO, "Loaded font subset `%s`", subset);
+			return EXIT_SUCCESS;
+		}
+		LOG(LOG_WARNING, "Could not load font subset `%s`, falling back to the full font", subset);
+	}
+
+	snprintf(path, sizeof(path) - 1U, "%s/resources/fonts/%s", abs_pwd, font);
+	return fbink_add_ot_font_v2(path, FNT_REGULAR, cfg);
+}
+
+// Poor man's grep in /proc/modules
+__attribute((nonnull(1))) static bool
+    is_module_loaded(const char* needle)
+{
+	FILE* f = fopen(PROCFS_ROOT "/modules", "re");
+	if (f) {
+		char   line[PIPE_BUF];
+		size_t len = strlen(needle);
+		while (fgets(line, sizeof(line), f)) {
+			if (strncmp(line, needle, len) == 0) {
+				fclose(f);
+				return true;
+			}
+		}
+		fclose(f);
+	}
+
+	return false;
+}
+
+// Parse an evdev event, looking for a power button press
+static bool
+    handle_evdev(struct libevdev* dev)
+{
+	int rc = 1;
+	do {
+		struct input_event ev;
+		rc = libevdev_next_event(dev, LIBEVDEV_READ_FLAG_NORMAL, &ev);
+		if (rc == LIBEVDEV_READ_STATUS_SYNC) {
+			while (rc == LIBEVDEV_READ_STATUS_SYNC) {
+				// NOTE: We're ignoring the sync delta events here.
+				rc = libevdev_next_event(dev, LIBEVDEV_READ_FLAG_SYNC, &ev);
+			}
+		} else if (rc == LIBEVDEV_READ_STATUS_SUCCESS) {
+			// Check if it's a power button press (well, release, actually)
+			if (libevdev_event_is_code(&ev, EV_KEY, KEY_POWER) == 1 && ev.value == 0) {
+				return true;
+			}
+		}
+	} while (rc == LIBEVDEV_READ_STATUS_SYNC || rc == LIBEVDEV_READ_STATUS_SUCCESS);
+	if (rc != LIBEVDEV_READ_STATUS_SUCCESS && rc != -EAGAIN) {
+		PFLOG(LOG_ERR, "Failed to handle input events: %s", strerror(-rc));
+	}
+
+	return false;
+}
+
+// Parse an evdev event, looking for a SW_DOCK switch
+static int
+    handle_usbc_evdev(struct libevdev* dev)
+{
+	int rc = 1;
+	do {
+		struct input_event ev;
+		rc = libevdev_next_event(dev, LIBEVDEV_READ_FLAG_NORMAL, &ev);
+		if (rc == LIBEVDEV_READ_STATUS_SYNC) {
+			while (rc == LIBEVDEV_READ_STATUS_SYNC) {
+				// NOTE: We're ignoring the sync delta events here.
+				rc = libevdev_next_event(dev, LIBEVDEV_READ_FLAG_SYNC, &ev);
+			}
+		} else if (rc == LIBEVDEV_READ_STATUS_SUCCESS) {
+			// If it's a SW_DOCK switch, return the value
+			if (libevdev_event_is_code(&ev, EV_SW, SW_DOCK) == 1) {
+				LOG(LOG_NOTICE, "Caught a USB-C plug %s event", ev.value ? "in" : "out");
+				return ev.value;
+			}
+		}
+	} while (rc == LIBEVDEV_READ_STATUS_SYNC || rc == LIBEVDEV_READ_STATUS_SUCCESS);
+	if (rc != LIBEVDEV_READ_STATUS_SUCCESS && rc != -EAGAIN) {
+		PFLOG(LOG_ERR, "Failed to handle input events: %s", strerror(-rc));
+	}
+
+	return -1;
+}
+
+// Parse an uevent
+static int
+    handle_uevent(struct uevent_listener* l, struct uevent* uevp)
+{
+	ue_reset_event(uevp);
+	ssize_t len = xread(l->pfd.fd, uevp->buf, sizeof(uevp->buf) - 1U);
+	if (len == -1) {
+		if (errno == ENOBUFS) {
+			// NOTE: Unlike ue_wait_for_event, don't recover:
+			//       since events were most likely lost, we'll consider this fatal
+			PFLOG(LOG_WARNING, "uevent overrun!");
+		}
+		PFLOG(LOG_CRIT, "read: %m");
+		return ERR_LISTENER_RECV;
+	}
+	char* end = uevp->buf + len;
+	*end      = '\0';
 
 	int rc = ue_parse_event_msg(uevp, (size_t) len);
 	if (rc == EXIT_SUCCESS) {
@@ -900,10 +1772,2281 @@ static int
 	} else if (rc == ERR_PARSE_INVALID_HDR) {
 		PFLOG(LOG_DEBUG, "skipped %zd bytes malformed uevent: `%.*s`", len, (int) len, uevp->buf);
 	} else {
-		PFLOG(LOG_DEBUG, "skipped %zd bytes unsupported uevent: `%.*s`", len, (int) len, uevp->buf);
+		PFLOG(LOG_DEBUG, "skipped %zd bytes unsupported uevent: `%.*s`", len, (int) len, uevp->buf);
+	}
+
+	return EXIT_FAILURE;
+}
+
+// Figure out whether a parsed uevent is one we care about
+static USB_EVENT_E
+    classify_uevent(const struct uevent* uevp)
+{
+	if (uevp->action == UEVENT_ACTION_CHANGE) {
+		if (uevp->subsystem && UE_STR_EQ(uevp->subsystem, "power_supply")) {
+			return USB_EVENT_CHARGE_TICK;
+		}
+		return USB_EVENT_NONE;
+	}
+
+	if (!uevp->devpath) {
+		return USB_EVENT_NONE;
+	}
+	switch (uevp->action) {
+		case UEVENT_ACTION_ADD:
+			if (UE_STR_EQ(uevp->devpath, KOBO_USB_DEVPATH_PLUG)) {
+				return USB_EVENT_PLUG_POWER;
+			} else if (UE_STR_EQ(uevp->devpath, KOBO_USB_DEVPATH_HOST)) {
+				return USB_EVENT_PLUG_HOST;
+			}
+			break;
+		case UEVENT_ACTION_REMOVE:
+			if (UE_STR_EQ(uevp->devpath, KOBO_USB_DEVPATH_PLUG) || UE_STR_EQ(uevp->devpath, KOBO_USB_DEVPATH_HOST)) {
+				return USB_EVENT_UNPLUG;
+			}
+			break;
+		case UEVENT_ACTION_OFFLINE:
+			if (UE_STR_EQ(uevp->devpath, KOBO_USB_DEVPATH_FSL) ||
+			    (uevp->modalias && UE_STR_EQ(uevp->modalias, KOBO_USB_MODALIAS_CI)) ||
+			    UE_STR_EQ(uevp->devpath, KOBO_USB_DEVPATH_UDC) || UE_STR_EQ(uevp->devpath, KOBO_USB_DEVPATH_MTK)) {
+				return USB_EVENT_EJECT;
+			}
+			break;
+		default:
+			break;
+	}
+	return USB_EVENT_NONE;
+}
+
+// Refresh the status bar (c.f., the clock timer in main)
+static int
+    on_clock_tick(USBMSReactor* reactor __attribute__((unused)), void* data)
+{
+	print_status(data);
+	return REACTOR_CONTINUE;
+}
+
+static int
+    on_countdown_tick(USBMSReactor* reactor __attribute__((unused)), void* data)
+{
+	USBMSWait* wait = data;
+	wait->elapsed  += 1;
+	print_countdown(MAX(0, wait->countdown - wait->elapsed), wait->ctx);
+	return wait->elapsed >= wait->countdown ? WAIT_COUNTDOWN : REACTOR_CONTINUE;
+}
+
+static int
+    on_power_button(USBMSReactor* reactor __attribute__((unused)),
+		    int           fd __attribute__((unused)),
+		    uint32_t      events __attribute__((unused)),
+		    void*         data)
+{
+	USBMSWait* wait = data;
+	if (handle_evdev(wait->dev)) {
+		// Refresh the status bar
+		print_status(wait->ctx);
+		LOG(LOG_NOTICE, "Caught a power button release");
+		return WAIT_POWER_BUTTON;
+	}
+	return REACTOR_CONTINUE;
+}
+
+static int
+    on_uevent(USBMSReactor* reactor __attribute__((unused)),
+	      int           fd __attribute__((unused)),
+	      uint32_t      events __attribute__((unused)),
+	      void*         data)
+{
+	USBMSWait* wait  = data;
+	int        ue_rc = handle_uevent(wait->listener, &wait->uev);
+	if (ue_rc == ERR_LISTENER_RECV) {
+		// Assume handle_uevent read failures to be fatal
+		return WAIT_FAILED;
+	} else if (ue_rc != EXIT_SUCCESS) {
+		return REACTOR_CONTINUE;
+	}
+
+	// Now check if it's one of the events we're waiting for…
+	USB_EVENT_E event = classify_uevent(&wait->uev);
+	if (wait->uevents & (1U << event)) {
+		// Refresh the status bar
+		print_status(wait->ctx);
+		wait->event = event;
+		return WAIT_UEVENT;
+	} else if (event == USB_EVENT_CHARGE_TICK) {
+		// Refresh the status bar
+		print_status(wait->ctx);
+		// NOTE: Any meaningful change *should* be accompanied by the relevant usb_host/usb_plug event,
+		//       this one is just for the status bar's sake.
+		// NOTE: That said, if we ever encounter weird cable sensing failures,
+		//       it *might* make sense to try to check POWER_SUPPLY_STATUS or POWER_SUPPLY_ONLINE
+		//       for specific POWER_SUPPLY_NAME in here?
+		//       Possibly with a bit of buffering to avoid surprises
+		//       (e.g., require two consecutive online > 0 or "Charging",
+		//       and reset the counter if not).
+		LOG(LOG_NOTICE, "Caught a charge tick");
+	}
+	return REACTOR_CONTINUE;
+}
+
+static int
+    on_usbc_event(USBMSReactor* reactor __attribute__((unused)),
+		  int           fd __attribute__((unused)),
+		  uint32_t      events __attribute__((unused)),
+		  void*         data)
+{
+	USBMSWait* wait     = data;
+	// I don't trust this very much (even in optimal conditions, it *will* fire multiple times),
+	// but we've seen some weird behavior on some host/device combos,
+	// so, if that's the best we have at the end of the plug in timeout,
+	// let the charger type detection figure it out...
+	// NOTE: During the session, on the other hand, this is purely informal,
+	//       I don't intend to *ever* trust it over uevent for anything...
+	wait->usb_c_plugged = handle_usbc_evdev(wait->usbc_dev);
+	return REACTOR_CONTINUE;
+}
+
+static int
+    on_udc_state(USBMSReactor* reactor, int fd, uint32_t events __attribute__((unused)), void* data)
+{
+	USBMSWait* wait = data;
+	// NOTE: Purely informative, like the USB-C controller: the eject/unplug uevents remain authoritative.
+	//       Re-reading it is what clears the event.
+	char gadget_state[16] = { 0 };
+	if (read_sysfs_attr(ATTR_UDC_STATE, gadget_state, sizeof(gadget_state)) != -1) {
+		LOG(LOG_INFO, "UDC state changed to `%s`", gadget_state);
+	}
+	// The fd may have been recycled (possibly under the same number), or dropped
+	reactor_del(reactor, fd);
+	wait->udc_fd = sysfs_attrs[ATTR_UDC_STATE].fd;
+	if (reactor_add(reactor, wait->udc_fd, EPOLLPRI, &on_udc_state, wait) == -1) {
+		wait->udc_fd = -1;
+	}
+	// The plug state is liable to have changed, too
+	print_status(wait->ctx);
+	return REACTOR_CONTINUE;
+}
+
+// Stop listening to whatever begin_wait registered
+static void
+    end_wait(USBMSReactor* reactor, USBMSWait* wait)
+{
+	reactor_del(reactor, wait->evfd);
+	reactor_del(reactor, wait->uefd);
+	reactor_del(reactor, wait->usbc_fd);
+	reactor_del(reactor, wait->udc_fd);
+	reactor_del_timer(reactor, wait->timer);
+	wait->timer = -1;
+}
+
+// Register everything wait listens to, and start its countdown, if any (c.f., on_countdown_tick)
+static int
+    begin_wait(USBMSReactor* reactor, USBMSWait* wait)
+{
+	wait->timer = -1;
+	if (reactor_add(reactor, wait->evfd, EPOLLIN, &on_power_button, wait) == -1 ||
+	    reactor_add(reactor, wait->uefd, EPOLLIN, &on_uevent, wait) == -1 ||
+	    reactor_add(reactor, wait->usbc_fd, EPOLLIN, &on_usbc_event, wait) == -1 ||
+	    reactor_add(reactor, wait->udc_fd, EPOLLPRI, &on_udc_state, wait) == -1) {
+		end_wait(reactor, wait);
+		return -1;
+	}
+
+	if (wait->countdown > 0) {
+		// Tick every second from now on
+		wait->elapsed = 0;
+		wait->timer   = reactor_add_timeout(reactor, 1000L, 1000L, &on_countdown_tick, wait);
+		if (wait->timer == -1) {
+			end_wait(reactor, wait);
+			return -1;
+		}
+		print_countdown(wait->countdown, wait->ctx);
+	}
+
+	return 0;
+}
+
+static const char*
+    usbms_step_name(USBMS_STEP_E step)
+{
+	switch (step) {
+		case USBMS_STEP_OK:
+			return "ok";
+		case USBMS_STEP_PLATFORM:
+			return "platform";
+		case USBMS_STEP_IN_SESSION:
+			return "session check";
+		case USBMS_STEP_UMOUNT:
+			return "umount";
+		case USBMS_STEP_MODULES:
+			return "modules";
+		case USBMS_STEP_CONFIGFS:
+			return "configfs";
+		case USBMS_STEP_UDC:
+			return "udc";
+		case USBMS_STEP_FSCK:
+			return "fsck";
+		case USBMS_STEP_MOUNT:
+			return "mount";
+		default:
+			return "unknown";
+	}
+}
+
+static const char*
+    phase_name(USBMS_PHASE_E phase)
+{
+	switch (phase) {
+		case PHASE_FBINK_INIT:
+			return "fbink_init";
+		case PHASE_FONTS:
+			return "fonts";
+		case PHASE_LOGO:
+			return "logo";
+		case PHASE_INPUT_SCAN:
+			return "input_scan";
+		case PHASE_BUSY_CHECK:
+			return "busy_check";
+		case PHASE_PLUG_WAIT:
+			return "plug_wait";
+		case PHASE_LOCK:
+			return "lock";
+		case PHASE_START_SESSION:
+			return "start_session";
+		case PHASE_HOST_SESSION:
+			return "host_session";
+		case PHASE_END_SESSION:
+			return "end_session";
+		case PHASE_FSCK:
+			return "fsck";
+		case PHASE_TIME_SYNC:
+			return "time_sync";
+		default:
+			return "unknown";
+	}
+}
+
+static void
+    trace_init(void)
+{
+	clock_gettime(CLOCK_MONOTONIC, &session_trace.start);
+	for (size_t i = 0U; i < PHASE_COUNT; i++) {
+		session_trace.phases[i].elapsed_us = -1L;
+		session_trace.phases[i].outer      = -1;
+	}
+	session_trace.last           = -1;
+	session_trace.current        = -1;
+	session_trace.first_paint_us = -1L;
+	session_trace.locked_kb      = -1L;
+}
+
+static long int
+    trace_elapsed_us(struct timespec* since)
+{
+	struct timespec now_ts = { 0 };
+	clock_gettime(CLOCK_MONOTONIC, &now_ts);
+	struct timespec td = { 0 };
+	timespec_delta(&now_ts, since, &td);
+	return (long int) td.tv_sec * 1000000L + td.tv_nsec / 1000L;
+}
+
+static void
+    trace_begin(USBMS_PHASE_E phase)
+{
+	clock_gettime(CLOCK_MONOTONIC, &session_trace.phases[phase].start);
+	session_trace.phases[phase].running = true;
+	session_trace.phases[phase].outer   = session_trace.current;
+	session_trace.last                  = (int) phase;
+	// NOTE: Atomic, because the allocator hooks may read it from the probe thread (c.f., current_alloc_stats)
+	__atomic_store_n(&session_trace.current, (int) phase, __ATOMIC_RELAXED);
+}
+
+static void
+    trace_end(USBMS_PHASE_E phase)
+{
+	USBMSPhase* p = &session_trace.phases[phase];
+	// NOTE: Accumulate, in case a phase ever runs more than once
+	if (p->elapsed_us < 0L) {
+		p->elapsed_us = 0L;
+	}
+	p->elapsed_us += trace_elapsed_us(&p->start);
+
+	p->running = false;
+	if (session_trace.current == (int) phase) {
+		__atomic_store_n(&session_trace.current, p->outer, __ATOMIC_RELAXED);
+	}
+}
+
+// Record a phase that was timed on the probe thread (c.f., USBMSProbe), once it's safe to touch session_trace.
+// NOTE: That's an assignment, not an accumulation, as it may be called again on the way out (c.f., main's cleanup).
+static void
+    trace_record(USBMS_PHASE_E phase, long int elapsed_us)
+{
+	if (elapsed_us >= 0L) {
+		session_trace.phases[phase].elapsed_us = elapsed_us;
+	}
+}
+
+#ifdef USBMS_MALLOC_STATS
+// NOTE: These are what the linker resolves our (and our static libraries') allocator calls to,
+//       c.f., MALLOC_STATS in the Makefile. libc's own internal allocations (e.g., stdio buffers) are out of reach.
+//       Charged to whatever phase the main thread is in, including what the probe thread does in the meantime.
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t nmemb, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+char* __real_strdup(const char* s);
+void  __real_free(void* ptr);
+void* __wrap_malloc(size_t size);
+void* __wrap_calloc(size_t nmemb, size_t size);
+void* __wrap_realloc(void* ptr, size_t size);
+char* __wrap_strdup(const char* s);
+void  __wrap_free(void* ptr);
+
+static USBMSAllocStats*
+    current_alloc_stats(void)
+{
+	int phase = __atomic_load_n(&session_trace.current, __ATOMIC_RELAXED);
+	return &alloc_stats[phase >= 0 ? (size_t) phase : PHASE_COUNT];
+}
+
+void*
+    __wrap_malloc(size_t size)
+{
+	__atomic_fetch_add(&current_alloc_stats()->allocs, 1UL, __ATOMIC_RELAXED);
+	return __real_malloc(size);
+}
+
+void*
+    __wrap_calloc(size_t nmemb, size_t size)
+{
+	__atomic_fetch_add(&current_alloc_stats()->allocs, 1UL, __ATOMIC_RELAXED);
+	return __real_calloc(nmemb, size);
+}
+
+void*
+    __wrap_realloc(void* ptr, size_t size)
+{
+	__atomic_fetch_add(&current_alloc_stats()->allocs, 1UL, __ATOMIC_RELAXED);
+	return __real_realloc(ptr, size);
+}
+
+char*
+    __wrap_strdup(const char* s)
+{
+	__atomic_fetch_add(&current_alloc_stats()->allocs, 1UL, __ATOMIC_RELAXED);
+	return __real_strdup(s);
+}
+
+void
+    __wrap_free(void* ptr)
+{
+	if (ptr) {
+		__atomic_fetch_add(&current_alloc_stats()->frees, 1UL, __ATOMIC_RELAXED);
+	}
+	__real_free(ptr);
+}
+#endif
+
+// Dump the trace as a single line of JSON, to USBMS_TRACE_FILE & syslog
+static void
+    dump_trace(int rv)
+{
+	// Close whatever phase we bailed out of
+	for (size_t i = 0U; i < PHASE_COUNT; i++) {
+		if (session_trace.phases[i].running) {
+			trace_end((USBMS_PHASE_E) i);
+		}
+	}
+
+	char        json[1024] = { 0 };
+	size_t      len        = 0U;
+	const char* exit_path  = rv == EXIT_SUCCESS ? "success" : (rv == USBMS_EARLY_EXIT ? "early_exit" : "failure");
+	len += (size_t) snprintf(json + len,
+				 sizeof(json) - len,
+				 "{\"version\":\"%s\",\"exit\":\"%s\",\"rv\":%d,\"last_phase\":\"%s\",\"scripts\":%s,"
+				 "\"first_paint_us\":%ld,\"locked_kb\":%ld,\"total_us\":%ld,\"phases_us\":{",
+				 USBMS_VERSION,
+				 exit_path,
+				 rv,
+				 session_trace.last >= 0 ? phase_name((USBMS_PHASE_E) session_trace.last) : "none",
+				 session_trace.use_scripts ? "true" : "false",
+				 session_trace.first_paint_us,
+				 session_trace.locked_kb,
+				 trace_elapsed_us(&session_trace.start));
+	bool first = true;
+	for (size_t i = 0U; i < PHASE_COUNT && len < sizeof(json); i++) {
+		if (session_trace.phases[i].elapsed_us < 0L) {
+			continue;
+		}
+		len += (size_t) snprintf(json + len,
+					 sizeof(json) - len,
+					 "%s\"%s\":%ld",
+					 first ? "" : ",",
+					 phase_name((USBMS_PHASE_E) i),
+					 session_trace.phases[i].elapsed_us);
+		first = false;
+	}
+#ifdef USBMS_MALLOC_STATS
+	// As [allocs, frees], per phase
+	if (len < sizeof(json)) {
+		len += (size_t) snprintf(json + len, sizeof(json) - len, "},\"allocs\":{");
+	}
+	first = true;
+	for (size_t i = 0U; i <= PHASE_COUNT && len < sizeof(json); i++) {
+		if (alloc_stats[i].allocs == 0UL && alloc_stats[i].frees == 0UL) {
+			continue;
+		}
+		len += (size_t) snprintf(json + len,
+					 sizeof(json) - len,
+					 "%s\"%s\":[%lu,%lu]",
+					 first ? "" : ",",
+					 i < PHASE_COUNT ? phase_name((USBMS_PHASE_E) i) : "none",
+					 alloc_stats[i].allocs,
+					 alloc_stats[i].frees);
+		first = false;
+	}
+#endif
+	if (len < sizeof(json)) {
+		snprintf(json + len, sizeof(json) - len, "}}");
+	}
+
+	LOG(LOG_INFO, "Session trace: %s", json);
+
+	// Write it atomically, so collectors never see a partial file
+	FILE* f = fopen(USBMS_TRACE_FILE ".tmp", "we");
+	if (!f) {
+		LOG(LOG_WARNING, "Could not open the trace file: %m");
+		return;
+	}
+	fprintf(f, "%s\n", json);
+	if (fclose(f) != 0 || rename(USBMS_TRACE_FILE ".tmp", USBMS_TRACE_FILE) == -1) {
+		LOG(LOG_WARNING, "Could not write the trace file: %m");
+	}
+}
+
+// Poor man's echo, for sysfs, configfs & procfs attributes
+__attribute__((nonnull(1, 2))) static int
+    write_attr(const char* path, const char* value)
+{
+	int fd = open(path, O_WRONLY | O_CLOEXEC);
+	if (fd == -1) {
+		PFLOG(LOG_WARNING, "open(\"%s\"): %m", path);
+		return -1;
+	}
+
+	// Like echo, append a LF (the kernel is used to it)
+	char buf[PATH_MAX] = { 0 };
+	int  len           = snprintf(buf, sizeof(buf), "%s\n", value);
+	int  rc            = 0;
+	if (len < 0 || (size_t) len >= sizeof(buf)) {
+		PFLOG(LOG_WARNING, "Value too long for `%s`", path);
+		rc = -1;
+	} else if (write_in_full(fd, buf, (size_t) len) != len) {
+		PFLOG(LOG_WARNING, "write(\"%s\"): %m", path);
+		rc = -1;
+	}
+	close(fd);
+
+	return rc;
+}
+
+// Poor man's mkdir -p, when we know the parent already exists
+__attribute__((nonnull(1))) static int
+    mkdir_exist_ok(const char* path)
+{
+	if (mkdir(path, 0755) == -1 && errno != EEXIST) {
+		PFLOG(LOG_WARNING, "mkdir(\"%s\"): %m", path);
+		return -1;
+	}
+	return 0;
+}
+
+// Poor man's insmod
+// NOTE: finit_module is Linux 3.8+, and Mk. 6 devices run 3.0.35, so, stick to init_module.
+__attribute__((nonnull(1, 2))) static int
+    load_module(const char* path, const char* params)
+{
+	int fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd == -1) {
+		PFLOG(LOG_NOTICE, "open(\"%s\"): %m", path);
+		return -1;
+	}
+	struct stat st;
+	if (fstat(fd, &st) == -1) {
+		PFLOG(LOG_WARNING, "fstat(\"%s\"): %m", path);
+		close(fd);
+		return -1;
+	}
+	void* image = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (image == MAP_FAILED) {
+		PFLOG(LOG_WARNING, "mmap(\"%s\"): %m", path);
+		return -1;
+	}
+
+	int rc = (int) syscall(SYS_init_module, image, (unsigned long) st.st_size, params);
+	if (rc == -1) {
+		PFLOG(LOG_NOTICE, "init_module(\"%s\"): %m", path);
+	} else {
+		LOG(LOG_INFO, "Loaded module `%s`", path);
+	}
+	munmap(image, (size_t) st.st_size);
+
+	return rc;
+}
+
+// On some devices/FW versions, some of the modules are builtins, so we can't just fire'n forget...
+__attribute__((nonnull(1))) static void
+    checked_load_module(const char* path)
+{
+	if (load_module(path, "") == -1) {
+		LOG(LOG_NOTICE, "Could not load `%s` (it might be built-in on your device)", path);
+	}
+}
+
+// Grab the serial number & FW version from Nickel's version tag, before we unmount onboard...
+static void
+    read_version_tag(char* serial, size_t serial_size, char* fw_version, size_t fw_version_size)
+{
+	snprintf(serial, serial_size, "%s", KOBO_DEFAULT_SERIAL);
+	snprintf(fw_version, fw_version_size, "%s", KOBO_DEFAULT_FW_VERSION);
+
+	FILE* f = fopen(KOBO_VERSION_TAG, "re");
+	if (!f) {
+		LOG(LOG_WARNING, "No Nickel version tag?!");
+		return;
+	}
+	char   tag[256] = { 0 };
+	size_t size     = fread(tag, sizeof(*tag), sizeof(tag) - 1U, f);
+	fclose(f);
+	if (size > 0) {
+		// Strip trailing LF
+		if (tag[size - 1U] == '\n') {
+			tag[size - 1U] = '\0';
+		}
+	}
+
+	// NOTE: The serial baked into the block device *may* be longer on some devices,
+	//       so use the same as Nickel to avoid issues with stuff that uses it to discriminate devices (i.e., Calibre).
+	//       Field 1 is the serial, field 3 the FW version.
+	char* cur = tag;
+	for (uint8_t field = 1U; field <= 3U; field++) {
+		char* token = strsep(&cur, ",");
+		if (!token) {
+			LOG(LOG_WARNING, "Could not parse Nickel version tag: `%s`", tag);
+			break;
+		}
+		if (field == 1U && *token) {
+			snprintf(serial, serial_size, "%s", token);
+		} else if (field == 3U && *token) {
+			snprintf(fw_version, fw_version_size, "%s", token);
+		}
+	}
+}
+
+// Returns the amount of dirty & under writeback memory, in kB (or 0 on failure)
+static unsigned long int
+    get_pending_writeback(void)
+{
+	int fd = open(PROCFS_ROOT "/meminfo", O_RDONLY | O_CLOEXEC);
+	if (fd == -1) {
+		return 0UL;
+	}
+	char    buf[4096] = { 0 };
+	ssize_t len       = read_in_full(fd, buf, sizeof(buf) - 1U);
+	close(fd);
+	if (len <= 0) {
+		return 0UL;
+	}
+
+	unsigned long int pending  = 0UL;
+	const char*       fields[] = { "\nDirty:", "\nWriteback:" };
+	for (size_t i = 0U; i < sizeof(fields) / sizeof(*fields); i++) {
+		const char* field = strstr(buf, fields[i]);
+		if (field) {
+			pending += strtoul(field + strlen(fields[i]), NULL, 10);
+		}
+	}
+	return pending;
+}
+
+// Sample the writeback progress (c.f., flush_exported_fs)
+static int
+    on_flush_tick(USBMSReactor* reactor __attribute__((unused)), void* data)
+{
+	USBMSFlush*       flush   = data;
+	unsigned long int pending = get_pending_writeback();
+	if (pending > flush->initial) {
+		flush->initial = pending;
+	}
+	// Don't bother for tiny amounts
+	if (flush->initial >= 4096UL) {
+		int pct = (int) (100UL - (pending * 100UL / flush->initial));
+		if (pct != flush->shown) {
+			char msg[256] = { 0 };
+			snprintf(msg,
+				 sizeof(msg),
+				 // @translators: First value is an amount of MB, second is a percentage.
+				 _("Starting USBMS session…\nFlushing %lu MB to disk (%d%%)…"),
+				 flush->initial / 1024UL,
+				 pct);
+			print_msg(msg, flush->ctx);
+			flush->shown = pct;
+		}
+	}
+	return REACTOR_CONTINUE;
+}
+
+static int
+    on_flush_exit(USBMSReactor* reactor __attribute__((unused)),
+		  int           fd,
+		  uint32_t      events __attribute__((unused)),
+		  void*         data)
+{
+	USBMSFlush* flush = data;
+	return reap_child(fd, flush->pid, &flush->status) ? WAIT_CHILD : REACTOR_CONTINUE;
+}
+
+// Flush the filesystems we're about to export (and *only* those) to disk,
+// while keeping the user posted about the progress of the writeback.
+// NOTE: syncfs blocks until it's done, so it's done in a child, whose completion we get through a signalfd,
+//       while the (main) reactor keeps the status bar ticking, and samples the writeback every 250ms.
+static void
+    flush_exported_fs(USBMSContext* ctx)
+{
+	const char* mountpoints[] = { KOBO_MOUNTPOINT, KOBO_SD_MOUNTPOINT };
+
+	// Block SIGCHLD so we can get it through a signalfd instead
+	sigset_t mask;
+	sigset_t old_mask;
+	sigemptyset(&mask);
+	sigaddset(&mask, SIGCHLD);
+	sigprocmask(SIG_BLOCK, &mask, &old_mask);
+	int sfd = signalfd(-1, &mask, SFD_NONBLOCK | SFD_CLOEXEC);
+	if (sfd == -1) {
+		LOG(LOG_WARNING, "signalfd: %m, falling back to a global sync");
+		sync();
+		sigprocmask(SIG_SETMASK, &old_mask, NULL);
+		return;
+	}
+
+	pid_t pid = fork();
+	if (pid == 0) {
+		for (size_t i = 0U; i < sizeof(mountpoints) / sizeof(*mountpoints); i++) {
+			int fd = open(mountpoints[i], O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+			if (fd == -1) {
+				continue;
+			}
+			if (syncfs(fd) == -1) {
+				// Shouldn't happen on any of our kernels, but better safe than sorry...
+				sync();
+			}
+			close(fd);
+		}
+		_exit(EXIT_SUCCESS);
+	} else if (pid == -1) {
+		LOG(LOG_WARNING, "fork: %m, falling back to a global sync");
+		sync();
+		close(sfd);
+		sigprocmask(SIG_SETMASK, &old_mask, NULL);
+		return;
+	}
+
+	// NOTE: /proc/meminfo is system-wide, but we're the only thing running, and the exported fs are the only ones
+	//       worth mentioning that are backed by actual storage, so, close enough ;).
+	USBMSFlush flush = { .ctx = ctx, .pid = pid, .initial = get_pending_writeback(), .shown = -1 };
+
+	// NOTE: Much like run_child, fall back to a reactor of our own if the UI isn't up (which shouldn't happen).
+	USBMSReactor  own_reactor = REACTOR_INITIALIZER;
+	USBMSReactor* reactor     = spawn_ui.reactor;
+	if (!reactor && reactor_init(&own_reactor) == 0) {
+		reactor = &own_reactor;
+	}
+	int timer = reactor ? reactor_add_timeout(reactor, 250L, 250L, &on_flush_tick, &flush) : -1;
+	if (!reactor || timer == -1 || reactor_add(reactor, sfd, EPOLLIN, &on_flush_exit, &flush) == -1 ||
+	    reactor_run(reactor) != WAIT_CHILD) {
+		// Can't do much else than wait for it, then
+		waitpid(pid, &flush.status, 0);
+	}
+	if (reactor) {
+		reactor_del(reactor, sfd);
+		reactor_del_timer(reactor, timer);
+		reactor_close(&own_reactor);
+	}
+	close(sfd);
+	sigprocmask(SIG_SETMASK, &old_mask, NULL);
+
+	LOG(LOG_INFO, "Flushed %lu kB of dirty data to disk", flush.initial);
+}
+
+// Drop the page cache of a block device we're about to export, since the host is going to write behind our back
+static void
+    invalidate_bdev(const char* device)
+{
+	int fd = open(device, O_RDONLY | O_CLOEXEC);
+	if (fd == -1) {
+		return;
+	}
+	if (ioctl(fd, BLKFLSBUF, 0) == -1) {
+		LOG(LOG_WARNING, "BLKFLSBUF on %s: %m", device);
+	}
+	posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+	close(fd);
+}
+
+// Export the internal (and external) storage over USBMS, without forking a shell (c.f., scripts/start-usbms.sh)
+static USBMS_STEP_E
+    start_usbms_session(USBMSContext* ctx)
+{
+	const char* platform = getenv("PLATFORM");
+	if (!platform) {
+		LOG(LOG_WARNING, "Unknown platform, cannot handle the USBMS session natively");
+		return USBMS_STEP_PLATFORM;
+	}
+	const char* product_id = getenv("USB_PRODUCT_ID");
+	if (!product_id) {
+		LOG(LOG_WARNING, "Unknown USB product ID, cannot handle the USBMS session natively");
+		return USBMS_STEP_PLATFORM;
+	}
+	const bool is_mtk                               = strcmp(platform, KOBO_PLATFORM_MTK) == 0;
+	char       modules_path[USBMS_MODULES_PATH_MAX] = { 0 };
+	if ((size_t) snprintf(modules_path, sizeof(modules_path), KOBO_MODULES_PATH "/%s", platform) >= sizeof(modules_path)) {
+		LOG(LOG_WARNING, "Unexpected platform `%s`, cannot handle the USBMS session natively", platform);
+		return USBMS_STEP_PLATFORM;
+	}
+	if (!is_mtk && access(modules_path, F_OK) != 0) {
+		LOG(LOG_WARNING, "No kernel modules for platform `%s`, cannot handle the USBMS session natively", platform);
+		return USBMS_STEP_PLATFORM;
+	}
+
+	// If we're already in the middle of an USBMS session, something went wrong...
+	if (is_module_loaded("g_file_storage ") || is_module_loaded("g_mass_storage ")) {
+		LOG(LOG_ERR, "Already in an USBMS session?!");
+		return USBMS_STEP_IN_SESSION;
+	}
+
+	char serial[64]     = { 0 };
+	char fw_version[32] = { 0 };
+	read_version_tag(serial, sizeof(serial), fw_version, sizeof(fw_version));
+
+	// NOTE: Follow Plato's lead, and hard-code the partitions (this doesn't apply to MTK).
+	char partitions[sizeof(KOBO_PARTITION "," KOBO_SD_PARTITION)] = KOBO_PARTITION;
+	if (access(KOBO_SD_PARTITION, F_OK) == 0) {
+		strncat(partitions, "," KOBO_SD_PARTITION, sizeof(partitions) - strlen(partitions) - 1U);
+	}
+
+	// Flush the exported filesystems to disk
+	// NOTE: Unlike the script, we don't do a global sync & drop_caches: the unmount drops the fs caches,
+	//       and we'll flush the block devices' themselves right after, so there's no need to evict the rootfs' caches,
+	//       which KOReader will need again on restart.
+	flush_exported_fs(ctx);
+
+	// And now, unmount it
+	// NOTE: Like the script, we're extremely paranoid and will only try a proper umount.
+	//       EINVAL means it wasn't mounted in the first place, which is fine.
+	const char* mountpoints[] = { KOBO_SD_MOUNTPOINT, KOBO_MOUNTPOINT };
+	for (size_t i = 0U; i < sizeof(mountpoints) / sizeof(*mountpoints); i++) {
+		if (umount(mountpoints[i]) == -1 && errno != EINVAL && errno != ENOENT) {
+			LOG(LOG_CRIT, "Failed to unmount %s, aborting! (%m)", mountpoints[i]);
+			return USBMS_STEP_UMOUNT;
+		}
+	}
+	invalidate_bdev(is_mtk ? KOBO_PARTITION_MTK : KOBO_PARTITION);
+	if (!is_mtk && access(KOBO_SD_PARTITION, F_OK) == 0) {
+		invalidate_bdev(KOBO_SD_PARTITION);
+	}
+
+	char path[PATH_MAX]   = { 0 };
+	char params[PATH_MAX] = { 0 };
+	if (!is_mtk) {
+		// NOTE: Disabling stalling appears to be necessary to avoid compatibility issues (usually on Windows)...
+		//       But even on Linux, things were sometimes a bit wonky if left enabled on devices with a sunxi SoC...
+		snprintf(path, sizeof(path), "%s/g_mass_storage.ko", modules_path);
+		if (access(path, F_OK) == 0) {
+			snprintf(params,
+				 sizeof(params),
+				 "file=%s stall=0 removable=1 idVendor=" KOBO_USB_VENDOR_ID
+				 " idProduct=%s iManufacturer=Kobo iProduct=eReader-%s iSerialNumber=%s",
+				 partitions,
+				 product_id,
+				 fw_version,
+				 serial);
+			if (load_module(path, params) == -1) {
+				return USBMS_STEP_MODULES;
+			}
+		} else {
+			if (strcmp(platform, "mx6sll-ntx") == 0 || strcmp(platform, "mx6ull-ntx") == 0) {
+				snprintf(params,
+					 sizeof(params),
+					 "file=%s stall=0 removable=1 idVendor=" KOBO_USB_VENDOR_ID
+					 " idProduct=%s iManufacturer=Kobo iProduct=eReader-%s iSerialNumber=%s",
+					 partitions,
+					 product_id,
+					 fw_version,
+					 serial);
+
+				// NOTE: FW 4.31.19086 made these builtins (at least on *some* devices), hence the defensive approach...
+				snprintf(path, sizeof(path), "%s/usb/gadget/configfs.ko", modules_path);
+				checked_load_module(path);
+				snprintf(path, sizeof(path), "%s/usb/gadget/libcomposite.ko", modules_path);
+				checked_load_module(path);
+				snprintf(path, sizeof(path), "%s/usb/gadget/usb_f_mass_storage.ko", modules_path);
+				checked_load_module(path);
+			} else {
+				snprintf(params,
+					 sizeof(params),
+					 "file=%s stall=0 removable=1 vendor=" KOBO_USB_VENDOR_ID
+					 " product=%s vendor_id=Kobo product_id=eReader-%s SN=%s",
+					 partitions,
+					 product_id,
+					 fw_version,
+					 serial);
+
+				// NOTE: arcotg_udc is builtin on Mk. 6, but old FW may have been shipping a broken module!
+				if (strcmp(platform, "mx6sl-ntx") != 0) {
+					snprintf(path, sizeof(path), "%s/usb/gadget/arcotg_udc.ko", modules_path);
+					checked_load_module(path);
+					// NOTE: The status bar keeps ticking in the meantime.
+					if (reactor_sleep(spawn_ui.reactor, 2L * 1000L) != WAIT_TIMER) {
+						LOG(LOG_ERR, "Failed to wait for arcotg_udc to settle");
+						return USBMS_STEP_MODULES;
+					}
+				}
+			}
+
+			snprintf(path, sizeof(path), "%s/usb/gadget/g_file_storage.ko", modules_path);
+			if (load_module(path, params) == -1) {
+				return USBMS_STEP_MODULES;
+			}
+		}
+
+		// Let's keep the mysterious NTX sleep... Given our experience with Wi-Fi modules, it's probably there for a reason ;p.
+		if (reactor_sleep(spawn_ui.reactor, 1L * 1000L) != WAIT_TIMER) {
+			LOG(LOG_ERR, "Failed to wait for g_file_storage to settle");
+			return USBMS_STEP_MODULES;
+		}
+
+		return USBMS_STEP_OK;
+	}
+
+	// MTK SoCs, via configfs
+	// c.f., https://docs.kernel.org/usb/gadget_configfs.html
+	// Modern Kobo V5 Firmware uses usb_gadget name kobo, older V5 and v4 uses g1
+	const char* gadget =
+	    access(KOBO_USB_GADGET_INIT, F_OK) == 0 ? DEFAULT_NICKEL_USB_GADGET2 : DEFAULT_NICKEL_USB_GADGET;
+	char gadget_path[USBMS_GADGET_PATH_MAX] = { 0 };
+	snprintf(gadget_path, sizeof(gadget_path), USB_GADGET_CONFIGFS "/%s", gadget);
+
+	// Create a gadget template named the same as Nickel's, and setup the required English strings
+	const char* dirs[] = {
+		"",
+		"/strings",
+		"/strings/0x409",
+		"/configs",
+		"/configs/c.1",
+		"/configs/c.1/strings",
+		"/configs/c.1/strings/0x409",
+		"/functions",
+		"/functions/mass_storage.0",
+		"/functions/mass_storage.0/lun.0",
+	};
+	for (size_t i = 0U; i < sizeof(dirs) / sizeof(*dirs); i++) {
+		snprintf(path, sizeof(path), "%s%s", gadget_path, dirs[i]);
+		if (mkdir_exist_ok(path) == -1) {
+			return USBMS_STEP_CONFIGFS;
+		}
+	}
+
+	// Fill out vID/pID & said English strings, as well as the configuration's, and point the LUN to the partition
+	char product[64] = { 0 };
+	snprintf(product, sizeof(product), "eReader-%s", fw_version);
+	const struct
+	{
+		const char* attr;
+		const char* value;
+	} attrs[] = {
+		{                                "/idVendor", KOBO_USB_VENDOR_ID },
+		{                               "/idProduct",         product_id },
+		{              "/strings/0x409/serialnumber",             serial },
+		{              "/strings/0x409/manufacturer",             "Kobo" },
+		{                   "/strings/0x409/product",            product },
+		{ "/configs/c.1/strings/0x409/configuration",      "KOBOeReader" },
+		{     "/functions/mass_storage.0/lun.0/file", KOBO_PARTITION_MTK },
+	};
+	for (size_t i = 0U; i < sizeof(attrs) / sizeof(*attrs); i++) {
+		snprintf(path, sizeof(path), "%s%s", gadget_path, attrs[i].attr);
+		if (write_attr(path, attrs[i].value) == -1) {
+			return USBMS_STEP_CONFIGFS;
+		}
+	}
+
+	// Bind function to config
+	// NOTE: Nickel never cleans up its own USBMS gadget, and we don't want to force an unlink, so make this conditional...
+	snprintf(path, sizeof(path), "%s/configs/c.1/mass_storage.0", gadget_path);
+	snprintf(params, sizeof(params), "%s/functions/mass_storage.0", gadget_path);
+	if (symlink(params, path) == -1 && errno != EEXIST) {
+		PFLOG(LOG_WARNING, "symlink(\"%s\"): %m", path);
+		return USBMS_STEP_CONFIGFS;
+	}
+
+	// Attach our new gadget device to the right USB Device Controller (c.f., /sys/class/udc)
+	snprintf(path, sizeof(path), "%s/UDC", gadget_path);
+	if (write_attr(path, KOBO_UDC_MTK) == -1) {
+		return USBMS_STEP_UDC;
+	}
+
+	return USBMS_STEP_OK;
+}
+
+// Poor man's rmmod
+__attribute__((nonnull(1))) static int
+    unload_module(const char* name)
+{
+	int rc = (int) syscall(SYS_delete_module, name, O_NONBLOCK | O_EXCL);
+	if (rc == -1) {
+		PFLOG(LOG_WARNING, "delete_module(\"%s\"): %m", name);
+	} else {
+		LOG(LOG_INFO, "Unloaded module `%s`", name);
+	}
+	return rc;
+}
+
+// On some devices/FW versions, some of the modules are builtins, so we can't just fire'n forget...
+__attribute__((nonnull(1))) static void
+    checked_unload_module(const char* name)
+{
+	char needle[64] = { 0 };
+	snprintf(needle, sizeof(needle), "%s ", name);
+	if (is_module_loaded(needle)) {
+		unload_module(name);
+	}
+}
+
+// Log how long a native session step took, and start timing the next one
+__attribute__((nonnull(1, 2))) static void
+    log_step_time(const char* step, struct timespec* step_ts)
+{
+	struct timespec now_ts = { 0 };
+	clock_gettime(CLOCK_MONOTONIC, &now_ts);
+	struct timespec td = { 0 };
+	timespec_delta(&now_ts, step_ts, &td);
+	LOG(LOG_INFO, "Step `%s` took %ld.%03ld sec", step, (long int) td.tv_sec, td.tv_nsec / 1000000L);
+	*step_ts = now_ts;
+}
+
+// Check a vfat partition, like the script: try twice, and give up if it's still not recoverable
+__attribute__((nonnull(1))) static int
+    check_partition(const char* partition)
+{
+	// If the host unmounted the volume cleanly, the FAT32 dirty flags will tell us so,
+	// which saves us from having dosfsck read the whole FAT & directory tree.
+	struct timespec t1 = { 0 };
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	size_t          bytes_read = 0U;
+	FAT_STATUS_E    status     = fat_check_dirty(partition, &bytes_read);
+	struct timespec t2         = { 0 };
+	clock_gettime(CLOCK_MONOTONIC, &t2);
+	struct timespec td = { 0 };
+	timespec_delta(&t2, &t1, &td);
+	LOG(LOG_INFO,
+	    "%s is %s (read %zu bytes in %ld us), %s",
+	    partition,
+	    status == FAT_STATUS_CLEAN ? "clean" : (status == FAT_STATUS_DIRTY ? "dirty" : "in an unknown state"),
+	    bytes_read,
+	    (long int) td.tv_sec * 1000000L + td.tv_nsec / 1000L,
+	    status == FAT_STATUS_CLEAN ? "skipping fsck" : "running fsck");
+	if (status == FAT_STATUS_CLEAN) {
+		return 0;
+	}
+
+	// If it's dirty, check it ourselves first: we only need to map the FAT & walk the directory tree,
+	// and if nothing's actually wrong (which is the usual outcome of an unclean eject), we just have to clear the flags.
+	// NOTE: We don't repair anything ourselves, that's still dosfsck's job.
+	if (status == FAT_STATUS_DIRTY) {
+		FATCheckReport report = { 0 };
+		clock_gettime(CLOCK_MONOTONIC, &t1);
+		int rc = fat_check_volume(partition, &report);
+		clock_gettime(CLOCK_MONOTONIC, &t2);
+		timespec_delta(&t2, &t1, &td);
+		if (rc == EXIT_SUCCESS) {
+			LOG(LOG_INFO,
+			    "Checked %s in %ld us: %u/%u free clusters, %u bad links, %u free links, %u cross-links, "
+			    "%u size mismatches, %u bad entries, %u lost clusters, %u FAT mismatches",
+			    partition,
+			    (long int) td.tv_sec * 1000000L + td.tv_nsec / 1000L,
+			    report.free_clusters,
+			    report.clusters,
+			    report.bad_links,
+			    report.free_links,
+			    report.cross_links,
+			    report.size_mismatches,
+			    report.bad_dirents,
+			    report.lost_clusters,
+			    report.fat_mismatches);
+			if (fat_report_is_clean(&report) && fat_clear_dirty(partition) == EXIT_SUCCESS) {
+				LOG(LOG_INFO, "%s is consistent, cleared the dirty flags, skipping fsck", partition);
+				return 0;
+			}
+		} else {
+			LOG(LOG_WARNING, "Failed to check %s (%s), running fsck", partition, strerror(-rc));
+		}
+	}
+
+	const USBMSChild dosfsck = { .name = "dosfsck", .argv = { "dosfsck", "-a", "-w", partition } };
+	for (uint8_t i = 0U; i < 2U; i++) {
+		int rc = run_child(&dosfsck);
+		if (rc == EXIT_SUCCESS) {
+			return 0;
+		}
+		LOG(LOG_WARNING, "dosfsck on %s failed (rc: %d)", partition, rc);
+	}
+
+	LOG(LOG_CRIT, "Unrecoverable filesystem corruption on %s, aborting!", partition);
+	return -1;
+}
+
+// Recompute the FSInfo free cluster count & next free hint, so that the kernel doesn't have to scan the FAT itself
+// on the first statfs after the remount. Returns true if FSInfo can be trusted.
+__attribute__((nonnull(1))) static bool
+    refresh_fsinfo(const char* partition)
+{
+	struct timespec t1 = { 0 };
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	uint32_t        free_clusters = 0U;
+	uint32_t        next_free     = 0U;
+	int             rc            = fat_update_fsinfo(partition, &free_clusters, &next_free);
+	struct timespec t2            = { 0 };
+	clock_gettime(CLOCK_MONOTONIC, &t2);
+	struct timespec td = { 0 };
+	timespec_delta(&t2, &t1, &td);
+	if (rc < 0) {
+		return false;
+	}
+	LOG(LOG_INFO,
+	    "%s has %u free clusters (next free: %u), FSInfo %s (took %ld us)",
+	    partition,
+	    free_clusters,
+	    next_free,
+	    rc == 1 ? "was stale, updated it" : "was accurate",
+	    (long int) td.tv_sec * 1000000L + td.tv_nsec / 1000L);
+	return true;
+}
+
+// NOTE: The kernel only trusts the FSInfo free cluster count with usefree,
+//       so only pass it when we've just made sure it's accurate.
+__attribute__((nonnull(1, 2))) static int
+    mount_partition(const char* partition, const char* mountpoint, bool usefree)
+{
+	if (mount(partition, mountpoint, "vfat", KOBO_MOUNT_FLAGS, usefree ? KOBO_MOUNT_DATA_USEFREE : KOBO_MOUNT_DATA) ==
+	    -1) {
+		LOG(LOG_CRIT, "Failed to mount %s on %s: %m", partition, mountpoint);
+		return -1;
+	}
+	LOG(LOG_INFO, "Mounted %s on %s%s", partition, mountpoint, usefree ? " (w/ usefree)" : "");
+	return 0;
+}
+
+// Remount internal (and external) storage after an USBMS session, without forking a shell (c.f., scripts/end-usbms.sh)
+static USBMS_STEP_E
+    end_usbms_session(void)
+{
+	const char* platform = getenv("PLATFORM");
+	if (!platform) {
+		LOG(LOG_WARNING, "Unknown platform, cannot handle the USBMS session natively");
+		return USBMS_STEP_PLATFORM;
+	}
+	const bool is_mtk                               = strcmp(platform, KOBO_PLATFORM_MTK) == 0;
+	char       modules_path[USBMS_MODULES_PATH_MAX] = { 0 };
+	if ((size_t) snprintf(modules_path, sizeof(modules_path), KOBO_MODULES_PATH "/%s", platform) >= sizeof(modules_path)) {
+		LOG(LOG_WARNING, "Unexpected platform `%s`, cannot handle the USBMS session natively", platform);
+		return USBMS_STEP_PLATFORM;
+	}
+	if (!is_mtk && access(modules_path, F_OK) != 0) {
+		LOG(LOG_WARNING, "No kernel modules for platform `%s`, cannot handle the USBMS session natively", platform);
+		return USBMS_STEP_PLATFORM;
+	}
+
+	struct timespec session_ts = { 0 };
+	clock_gettime(CLOCK_MONOTONIC, &session_ts);
+	struct timespec step_ts = session_ts;
+
+	char        path[PATH_MAX] = { 0 };
+	const char* partition      = NULL;
+	if (!is_mtk) {
+		// If we're NOT in the middle of an USBMS session, something went wrong...
+		if (!is_module_loaded("g_file_storage ") && !is_module_loaded("g_mass_storage ")) {
+			LOG(LOG_ERR, "Not in an USBMS session?!");
+			return USBMS_STEP_IN_SESSION;
+		}
+
+		snprintf(path, sizeof(path), "%s/g_mass_storage.ko", modules_path);
+		if (access(path, F_OK) == 0) {
+			if (unload_module("g_mass_storage") == -1) {
+				return USBMS_STEP_MODULES;
+			}
+		} else {
+			if (unload_module("g_file_storage") == -1) {
+				return USBMS_STEP_MODULES;
+			}
+
+			if (strcmp(platform, "mx6sll-ntx") == 0 || strcmp(platform, "mx6ull-ntx") == 0) {
+				// Since FW 4.31.19086, these may be builtins...
+				checked_unload_module("usb_f_mass_storage");
+				checked_unload_module("libcomposite");
+				checked_unload_module("configfs");
+			} else {
+				// NOTE: See start_usbms_session for why we have to double-check this one...
+				if (strcmp(platform, "mx6sl-ntx") != 0) {
+					checked_unload_module("arcotg_udc");
+				}
+			}
+		}
+		log_step_time("modules", &step_ts);
+
+		// Let's keep the mysterious NTX sleep... Given our experience with Wi-Fi modules, it's probably there for a reason ;p.
+		// NOTE: Unlike on the way in, we can't just give up if it's cut short, as we still need to remount everything.
+		if (reactor_sleep(spawn_ui.reactor, 1L * 1000L) != WAIT_TIMER) {
+			LOG(LOG_WARNING, "Failed to wait for g_file_storage to settle, carrying on anyway");
+		}
+		log_step_time("settle", &step_ts);
+
+		partition = KOBO_PARTITION;
+	} else {
+		// Modern Kobo V5 Firmware uses usb_gadget name kobo, older V5 and v4 uses g1
+		const char* gadget =
+		    access(KOBO_USB_GADGET_INIT, F_OK) == 0 ? DEFAULT_NICKEL_USB_GADGET2 : DEFAULT_NICKEL_USB_GADGET;
+		char gadget_path[USBMS_GADGET_PATH_MAX] = { 0 };
+		snprintf(gadget_path, sizeof(gadget_path), USB_GADGET_CONFIGFS "/%s", gadget);
+
+		// If we're NOT in the middle of an USBMS session, something went wrong...
+		snprintf(path, sizeof(path), "%s/UDC", gadget_path);
+		FILE* f = fopen(path, "re");
+		if (!f) {
+			LOG(LOG_ERR, "Not in an USBMS session?! (%m)");
+			return USBMS_STEP_IN_SESSION;
+		}
+		char   udc[32] = { 0 };
+		size_t size    = fread(udc, sizeof(*udc), sizeof(udc) - 1U, f);
+		fclose(f);
+		if (size > 0) {
+			// Strip trailing LF
+			if (udc[size - 1U] == '\n') {
+				udc[size - 1U] = '\0';
+			}
+		}
+		if (strcmp(udc, KOBO_UDC_MTK) != 0) {
+			LOG(LOG_ERR, "Not in an USBMS session?! (UDC: `%s`)", udc);
+			return USBMS_STEP_IN_SESSION;
+		}
+
+		// Disable the gadget
+		if (write_attr(path, "") == -1) {
+			return USBMS_STEP_UDC;
+		}
+		log_step_time("udc", &step_ts);
+
+		// Unbind function from config
+		snprintf(path, sizeof(path), "%s/configs/c.1/mass_storage.0", gadget_path);
+		if (unlink(path) == -1) {
+			PFLOG(LOG_WARNING, "unlink(\"%s\"): %m", path);
+			return USBMS_STEP_CONFIGFS;
+		}
+		// Then tear down the config's strings, the config, the function, the gadget's strings, and the gadget itself
+		const char* dirs[] = {
+			"/configs/c.1/strings/0x409", "/configs/c.1", "/functions/mass_storage.0", "/strings/0x409", "",
+		};
+		for (size_t i = 0U; i < sizeof(dirs) / sizeof(*dirs); i++) {
+			snprintf(path, sizeof(path), "%s%s", gadget_path, dirs[i]);
+			if (rmdir(path) == -1) {
+				PFLOG(LOG_WARNING, "rmdir(\"%s\"): %m", path);
+				return USBMS_STEP_CONFIGFS;
+			}
+		}
+		log_step_time("configfs", &step_ts);
+
+		// Modern Kobo V5 Firmware has this init script which preconfigures the usb gadget for usb mass storage,
+		// and Nickel expects it to be set up, otherwise its own USBMS handling won't work.
+		// It always checks whether the kobo usb gadget exists, and creates/configures it if not.
+		if (access(KOBO_USB_GADGET_INIT, F_OK) == 0) {
+			int rc = run_child(
+			    &(const USBMSChild){ .name = "usb-gadget", .argv = { KOBO_USB_GADGET_INIT }, .timeout = 30 });
+			if (rc != EXIT_SUCCESS) {
+				LOG(LOG_WARNING, "Failed to restore Nickel's USB gadget (rc: %d)", rc);
+			}
+			log_step_time("gadget init", &step_ts);
+		}
+
+		partition = KOBO_PARTITION_MTK;
+	}
+
+	// NOTE: Be a tad less heavy-handed than the stock script with the amount of fscks, but do abort if it's not recoverable...
+	trace_begin(PHASE_FSCK);
+	int fsck_rc = check_partition(partition);
+	trace_end(PHASE_FSCK);
+	if (fsck_rc == -1) {
+		return USBMS_STEP_FSCK;
+	}
+	log_step_time("fsck", &step_ts);
+
+	// NOTE: The host may have left FSInfo stale, so refresh it now, as part of the remount,
+	//       rather than stalling KOReader's first free space query.
+	//       We only do that for onboard, though: FSInfo is computed from the FAT, and the SD card's is never checked
+	//       (see below), so we can't vouch for it, and we'd rather not write to it, either.
+	const bool onboard_usefree = refresh_fsinfo(partition);
+	log_step_time("fsinfo", &step_ts);
+
+	if (mount_partition(partition, KOBO_MOUNTPOINT, onboard_usefree) == -1) {
+		return USBMS_STEP_MOUNT;
+	}
+	// Handle the SD card now (again, not dealing with the dynamic detection nonsense).
+	// NOTE: Mimic the stock script and never check the external SD card...
+	//       While I'm not necessarily a fan of this approach,
+	//       one of the benefits is that we avoid a potentially time consuming process for larger cards.
+	if (access(KOBO_SD_PARTITION, F_OK) == 0) {
+		if (mount_partition(KOBO_SD_PARTITION, KOBO_SD_MOUNTPOINT, false) == -1) {
+			return USBMS_STEP_MOUNT;
+		}
+	}
+	log_step_time("mount", &step_ts);
+
+	log_step_time("total", &session_ts);
+	return USBMS_STEP_OK;
+}
+
+// Map our resource bundle, if we shipped one (c.f., tools/mkbundle.py)
+__attribute__((nonnull)) static void
+    open_bundle(USBMSBundle* bundle, const char* abs_pwd)
+{
+	char path[PATH_MAX] = { 0 };
+	snprintf(path, sizeof(path) - 1U, "%s/%s", abs_pwd, USBMS_BUNDLE_FILE);
+	int fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd == -1) {
+		LOG(LOG_INFO, "No resource bundle, falling back to loose resources");
+		return;
+	}
+	struct stat st;
+	if (fstat(fd, &st) == -1 || (size_t) st.st_size < sizeof(USBMSBundleHeader)) {
+		LOG(LOG_WARNING, "Resource bundle is truncated, ignoring it");
+		close(fd);
+		return;
+	}
+	// NOTE: We only ever touch the pages we actually need, and FBInk reads them straight from the mapping
+	void* map = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED) {
+		PFLOG(LOG_WARNING, "mmap: %m");
+		return;
+	}
+
+	const USBMSBundleHeader* header = map;
+	if (memcmp(header->magic, USBMS_BUNDLE_MAGIC, sizeof(header->magic)) != 0 ||
+	    header->version != USBMS_BUNDLE_VERSION ||
+	    sizeof(*header) + header->count * sizeof(USBMSBundleEntry) > (size_t) st.st_size) {
+		LOG(LOG_WARNING, "Resource bundle is invalid, ignoring it");
+		munmap(map, (size_t) st.st_size);
+		return;
+	}
+	bundle->map  = map;
+	bundle->size = (size_t) st.st_size;
+	LOG(LOG_INFO, "Mapped resource bundle (%u entries)", header->count);
+}
+
+static void
+    close_bundle(USBMSBundle* bundle)
+{
+	if (bundle->map) {
+		munmap(bundle->map, bundle->size);
+		bundle->map = NULL;
+	}
+}
+
+// Look an entry up in our resource bundle, returns NULL if it isn't there (or if we don't have a bundle)
+__attribute__((nonnull)) static const USBMSBundleEntry*
+    find_bundle_entry(const USBMSBundle* bundle, const char* name)
+{
+	if (!bundle->map) {
+		return NULL;
+	}
+	const USBMSBundleHeader* header  = (const USBMSBundleHeader*) bundle->map;
+	const USBMSBundleEntry*  entries = (const USBMSBundleEntry*) (bundle->map + sizeof(*header));
+	for (const USBMSBundleEntry* entry = entries; entry < entries + header->count; entry++) {
+		if (strncmp(entry->name, name, sizeof(entry->name)) == 0) {
+			// Don't trust it blindly
+			if (entry->offset > bundle->size || entry->size > bundle->size - entry->offset) {
+				LOG(LOG_WARNING, "Resource bundle entry `%s` is out of bounds", name);
+				return NULL;
+			}
+			return entry;
+		}
+	}
+	return NULL;
+}
+
+// Fill in the logo cache's key for the current state of the framebuffer
+static void
+    logo_cache_key(const USBMSContext* ctx, USBMSLogoCache* cache)
+{
+	cache->version = USBMS_LOGO_CACHE_VERSION;
+	snprintf(cache->usbms_version, sizeof(cache->usbms_version), "%s", USBMS_VERSION);
+	cache->screen_width  = ctx->fbink_state.screen_width;
+	cache->screen_height = ctx->fbink_state.screen_height;
+	cache->bpp           = ctx->fbink_state.bpp;
+	cache->current_rota  = ctx->fbink_state.current_rota;
+	cache->is_inverted   = ctx->fbink_cfg.is_inverted;
+}
+
+// Blit back the logo as a previous launch rendered it on this very same framebuffer, if we can
+static bool
+    restore_logo_cache(USBMSContext* ctx)
+{
+	int fd = open(USBMS_LOGO_CACHE, O_RDONLY | O_CLOEXEC);
+	if (fd == -1) {
+		return false;
+	}
+
+	bool           restored = false;
+	FBInkDump      dump     = { 0 };
+	USBMSLogoCache cache    = { 0 };
+	USBMSLogoCache key      = { 0 };
+	logo_cache_key(ctx, &key);
+	if (read_in_full(fd, &cache, sizeof(cache)) != (ssize_t) sizeof(cache) || cache.version != key.version ||
+	    strcmp(cache.usbms_version, key.usbms_version) != 0 || cache.screen_width != key.screen_width ||
+	    cache.screen_height != key.screen_height || cache.bpp != key.bpp || cache.current_rota != key.current_rota ||
+	    cache.is_inverted != key.is_inverted) {
+		LOG(LOG_INFO, "Discarding a stale logo cache");
+		goto cleanup;
+	}
+
+	dump.data = malloc(cache.size);
+	if (!dump.data) {
+		goto cleanup;
+	}
+	if (read_in_full(fd, dump.data, cache.size) != (ssize_t) cache.size) {
+		LOG(LOG_WARNING, "Logo cache is truncated");
+		goto cleanup;
+	}
+	dump.stride  = cache.stride;
+	dump.size    = cache.size;
+	dump.area    = cache.area;
+	dump.clip    = cache.clip;
+	dump.rota    = cache.rota;
+	dump.bpp     = cache.dump_bpp;
+	dump.is_full = cache.is_full;
+	restored     = fbink_restore(ctx->fbfd, &ctx->fbink_cfg, &dump) == EXIT_SUCCESS;
+
+cleanup:
+	if (dump.data) {
+		fbink_free_dump_data(&dump);
+	}
+	close(fd);
+
+	return restored;
+}
+
+// Save what print_logo just rendered, for the next launches
+static void
+    save_logo_cache(const USBMSContext* ctx)
+{
+	// NOTE: We want the rect in the fb's own layout, which is what fbink_rect_dump expects
+	const FBInkRect rect = fbink_get_last_rect(true);
+	FBInkDump       dump = { 0 };
+	if (fbink_rect_dump(ctx->fbfd, &rect, &dump) != EXIT_SUCCESS) {
+		return;
+	}
+
+	USBMSLogoCache cache = { 0 };
+	logo_cache_key(ctx, &cache);
+	cache.area     = dump.area;
+	cache.clip     = dump.clip;
+	cache.rota     = dump.rota;
+	cache.dump_bpp = dump.bpp;
+	cache.is_full  = dump.is_full;
+	cache.stride   = (uint32_t) dump.stride;
+	cache.size     = (uint32_t) dump.size;
+
+	// Write it atomically, so we never blit a partial file
+	int fd = open(USBMS_LOGO_CACHE ".tmp", O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+	if (fd == -1) {
+		PFLOG(LOG_WARNING, "open(\"%s\"): %m", USBMS_LOGO_CACHE ".tmp");
+		fbink_free_dump_data(&dump);
+		return;
+	}
+	bool ok = write_in_full(fd, &cache, sizeof(cache)) == (ssize_t) sizeof(cache) &&
+		  write_in_full(fd, dump.data, dump.size) == (ssize_t) dump.size;
+	if (close(fd) != 0 || !ok || rename(USBMS_LOGO_CACHE ".tmp", USBMS_LOGO_CACHE) == -1) {
+		LOG(LOG_WARNING, "Could not write the logo cache: %m");
+		unlink(USBMS_LOGO_CACHE ".tmp");
+	}
+	fbink_free_dump_data(&dump);
+}
+
+// Display the KOReader logo: blitted back from the logo cache if possible,
+// otherwise from our bundle (where it's pre-decoded & pre-scaled), or from the PNG as a last resort.
+__attribute__((nonnull)) static void
+    print_logo(USBMSContext* ctx, const char* abs_pwd)
+{
+	trace_begin(PHASE_LOGO);
+	const char* source = "cache";
+	if (!restore_logo_cache(ctx)) {
+		ctx->fbink_cfg.ignore_alpha  = true;
+		ctx->fbink_cfg.halign        = CENTER;
+		ctx->fbink_cfg.scaled_height = (short int) (ctx->fbink_state.screen_height / 10U);
+		ctx->fbink_cfg.row           = 3;
+
+		int                     rc   = ERRCODE(EXIT_FAILURE);
+		const USBMSBundleEntry* logo = find_bundle_entry(&ctx->bundle, "img/koreader");
+		if (logo && (size_t) logo->width * logo->height == logo->size) {
+			source = "bundle";
+			rc     = fbink_print_raw_data(ctx->fbfd,
+                                                  ctx->bundle.map + logo->offset,
+                                                  (int) logo->width,
+                                                  (int) logo->height,
+                                                  logo->size,
+                                                  0,
+                                                  0,
+                                                  &ctx->fbink_cfg);
+		} else {
+			source              = "png";
+			char path[PATH_MAX] = { 0 };
+			snprintf(path, sizeof(path) - 1U, "%s/resources/img/koreader.png", abs_pwd);
+			rc = fbink_print_image(ctx->fbfd, path, 0, 0, &ctx->fbink_cfg);
+		}
+		if (rc == EXIT_SUCCESS) {
+			save_logo_cache(ctx);
+		}
+	}
+	trace_end(PHASE_LOGO);
+	LOG(LOG_INFO, "Logo painted in %ld us (from the %s)", session_trace.phases[PHASE_LOGO].elapsed_us, source);
+}
+
+// Load our fonts (c.f., free_fonts)
+__attribute__((nonnull)) static int
+    load_fonts(USBMSContext* ctx, const char* abs_pwd, bool is_CJK)
+{
+	trace_begin(PHASE_FONTS);
+	if (add_ot_font(abs_pwd, "CaskaydiaCove_NF.subset.ttf", "CaskaydiaCove_NF.ttf", &ctx->icon_cfg) !=
+	    EXIT_SUCCESS) {
+		PFLOG(LOG_CRIT, "Could not load main font!");
+		return ERRCODE(EXIT_FAILURE);
+	}
+	// NOTE: Minor hackery: instead of the custom LGC Nerdfont we ship, for CJK, use KOReader's own CJK font…
+	//       (The only remotely CJK-ish NerdFont available is M+, and it's more J than CJK ;)).
+	if (is_CJK) {
+		// NOTE: We may ship a subset of it tailored to this specific translation
+		char cjk_subset[NAME_MAX] = { 0 };
+		snprintf(cjk_subset, sizeof(cjk_subset) - 1U, "NotoSansCJKsc-Regular.%s.otf", tr_lang->catalog);
+		if (add_ot_font(abs_pwd, cjk_subset, "NotoSansCJKsc-Regular.otf", &ctx->msg_cfg) != EXIT_SUCCESS) {
+			PFLOG(LOG_CRIT, "Could not load CJK font!");
+			fbink_free_ot_fonts_v2(&ctx->icon_cfg);
+			return ERRCODE(EXIT_FAILURE);
+		}
+	} else {
+		// If we don't need CJK support, we simply use the main font everywhere
+		ctx->msg_cfg.font = ctx->icon_cfg.font;
+	}
+	// NOTE: The header aside (c.f., paint_header), ot_cfg is only used for the status bar,
+	//       which doesn't need CJK support
+	ctx->ot_cfg.font = ctx->icon_cfg.font;
+	trace_end(PHASE_FONTS);
+	return EXIT_SUCCESS;
+}
+
+static void
+    free_fonts(USBMSContext* ctx, bool is_CJK)
+{
+	fbink_free_ot_fonts_v2(&ctx->icon_cfg);
+	if (is_CJK) {
+		fbink_free_ot_fonts_v2(&ctx->msg_cfg);
+	} else {
+		// We share the same font everywhere, so just avoid dangling pointers
+		ctx->msg_cfg.font = NULL;
+	}
+	ctx->ot_cfg.font = NULL;
+}
+
+// Clear the screen, and display our header
+static void
+    paint_header(USBMSContext* ctx, bool is_CJK)
+{
+	ctx->fbink_cfg.no_refresh = true;
+	fbink_cls(ctx->fbfd, &ctx->fbink_cfg, NULL, false);
+	ctx->ot_cfg.margins.top = (short int) ctx->fbink_state.font_h;
+	ctx->ot_cfg.size_px     = (unsigned short int) (ctx->fbink_state.font_h * 2U);
+	if (is_CJK) {
+		// The title actually requires CJK support, so point it at our CJK font…
+		ctx->ot_cfg.font = ctx->msg_cfg.font;
+	}
+	fbink_print_ot(ctx->fbfd, _("USB Mass Storage"), &ctx->ot_cfg, &ctx->fbink_cfg, NULL);
+	if (is_CJK) {
+		// Back to the main font, as this will only be used for the status bar from now on
+		ctx->ot_cfg.font = ctx->icon_cfg.font;
+	}
+	ctx->fbink_cfg.no_refresh  = false;
+	ctx->fbink_cfg.is_flashing = true;
+	fbink_refresh(ctx->fbfd, 0, 0, 0, 0, &ctx->fbink_cfg);
+	ctx->fbink_cfg.is_flashing = false;
+	// Keep an eye on that one
+	session_trace.first_paint_us = trace_elapsed_us(&session_trace.start);
+	LOG(LOG_INFO, "Header painted %ld ms after startup", session_trace.first_paint_us / 1000L);
+}
+
+// How much memory the kernel thinks is available, in kB (or -1 on failure)
+static long int
+    get_mem_available(void)
+{
+	FILE* f = fopen(PROCFS_ROOT "/meminfo", "re");
+	if (!f) {
+		return -1L;
+	}
+	char     line[128] = { 0 };
+	long int available = -1L;
+	long int estimate  = 0L;
+	long int value     = 0L;
+	while (fgets(line, sizeof(line), f)) {
+		if (sscanf(line, "MemAvailable: %ld kB", &value) == 1) {
+			available = value;
+			break;
+		}
+		// NOTE: MemAvailable is Linux 3.14+, so, on older kernels, make do with a rough estimate
+		if (sscanf(line, "MemFree: %ld kB", &value) == 1 || sscanf(line, "Buffers: %ld kB", &value) == 1 ||
+		    sscanf(line, "Cached: %ld kB", &value) == 1) {
+			estimate += value;
+		}
+	}
+	fclose(f);
+	return available != -1L ? available : estimate;
+}
+
+// Look a field up in our own /proc/self/status, in kB (or -1 on failure)
+__attribute__((nonnull)) static long int
+    get_proc_status_kb(const char* field)
+{
+	FILE* f = fopen(PROCFS_ROOT "/self/status", "re");
+	if (!f) {
+		return -1L;
+	}
+	char     line[128] = { 0 };
+	size_t   len       = strlen(field);
+	long int value     = -1L;
+	while (fgets(line, sizeof(line), f)) {
+		if (strncmp(line, field, len) == 0 && line[len] == ':') {
+			if (sscanf(line + len + 1U, "%ld kB", &value) != 1) {
+				value = -1L;
+			}
+			break;
+		}
+	}
+	fclose(f);
+	return value;
+}
+
+// Keep a file mapped, so that mlockall pins its page cache
+__attribute__((nonnull)) static void
+    pin_file(USBMSPinnedFile* pinned, const char* path)
+{
+	int fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd == -1) {
+		LOG(LOG_WARNING, "Could not pin `%s`: %m", path);
+		return;
+	}
+	struct stat st;
+	if (fstat(fd, &st) == -1 || st.st_size == 0) {
+		close(fd);
+		return;
+	}
+	void* map = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED) {
+		PFLOG(LOG_WARNING, "mmap: %m");
+		return;
+	}
+	pinned->map  = map;
+	pinned->size = (size_t) st.st_size;
+}
+
+static void
+    unpin_files(USBMSContext* ctx)
+{
+	for (USBMSPinnedFile* pinned = ctx->pinned; pinned < ctx->pinned + USBMS_PINNED_FILES; pinned++) {
+		if (pinned->map) {
+			munmap(pinned->map, pinned->size);
+			pinned->map = NULL;
+		}
+	}
+}
+
+// Locked session (c.f., USBMS_LOCKED_SESSION): once onboard is exported, any major fault on our UI path
+// would have to go through the very block device the host is hammering.
+// So, before we export it, make sure everything we'll need until it's back is resident, and stays that way.
+// NOTE: Our fonts are already fully read in memory by FBInk, and the translations are compiled in,
+//       so rendering the session & teardown screens only ever needs our own code & anonymous memory.
+//       MCL_CURRENT faults in every mapping we have (i.e., usbms itself, FBInk, libevdev, libc & co).
+//       Whatever we allocate later isn't covered, but that could only ever be paged out to swap,
+//       and if swap lived on an exported partition, it's already been disabled by then (c.f., the busy check).
+//       The only file we'll still want to read is the teardown script (and the shell to run it),
+//       should we have to fall back to it, so we map them to get their page cache pinned, too.
+static void
+    lock_session(USBMSContext* ctx, const char* abs_pwd)
+{
+	// The logo is long gone, there's no need to keep the bundle around
+	close_bundle(&ctx->bundle);
+
+	char path[PATH_MAX] = { 0 };
+	snprintf(path, sizeof(path) - 1U, "%s/scripts/end-usbms.sh", abs_pwd);
+	pin_file(&ctx->pinned[0], path);
+	pin_file(&ctx->pinned[1], "/bin/sh");
+
+	if (mlockall(MCL_CURRENT) == -1) {
+		PFLOG(LOG_WARNING, "mlockall: %m");
+		unpin_files(ctx);
+		return;
+	}
+
+	session_trace.locked_kb = get_proc_status_kb("VmLck");
+	LOG(LOG_INFO,
+	    "Locked session: %ld kB locked (RSS: %ld kB)",
+	    session_trace.locked_kb,
+	    get_proc_status_kb("VmRSS"));
+}
+
+static void
+    unlock_session(USBMSContext* ctx)
+{
+	munlockall();
+	unpin_files(ctx);
+}
+
+// Give our preloaded resources back if memory is getting tight (c.f., run_standby)
+static int
+    on_standby_memcheck(USBMSReactor* reactor, void* data)
+{
+	USBMSStandby* standby   = data;
+	long int      available = get_mem_available();
+	if (available != -1L && available < USBMS_STANDBY_MIN_AVAIL_KB) {
+		LOG(LOG_NOTICE,
+		    "Memory is getting tight (%ld kB available), releasing our preloaded resources",
+		    available);
+		free_icon_cache(standby->ctx);
+		free_fonts(standby->ctx, standby->is_CJK);
+		malloc_trim(0);
+		// NOTE: Nothing left to give back, so there's no point in waking up until the next session request
+		reactor_del_timer(reactor, standby->memcheck);
+		standby->memcheck = -1;
+	}
+	return REACTOR_CONTINUE;
+}
+
+// Send a standby client its reply, and hang up
+static void
+    standby_reply(int cfd, unsigned char reply)
+{
+	send(cfd, &reply, sizeof(reply), MSG_NOSIGNAL);
+	close(cfd);
+}
+
+// Handle a single request on the standby socket (c.f., run_standby)
+static int
+    on_standby_request(USBMSReactor* reactor, int fd, uint32_t events __attribute__((unused)), void* data)
+{
+	USBMSStandby* standby = data;
+	int           cfd     = accept4(fd, NULL, NULL, SOCK_CLOEXEC);
+	if (cfd == -1) {
+		PFLOG(LOG_WARNING, "accept4: %m");
+		return REACTOR_CONTINUE;
+	}
+	// Don't let a misbehaving client wedge us
+	struct timeval timeout = { .tv_sec = 1 };
+	setsockopt(cfd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+	unsigned char cmd = 0U;
+	if (read(cfd, &cmd, sizeof(cmd)) != sizeof(cmd)) {
+		close(cfd);
+		return REACTOR_CONTINUE;
+	}
+
+	// NOTE: There can only ever be one session at a time, and we can't leave while one is still live,
+	//       as its client is still waiting on us for its exit code.
+	if (standby->pid != -1) {
+		LOG(LOG_WARNING, "Ignoring standby command %#hhx, a session is still running", cmd);
+		standby_reply(cfd, USBMS_EARLY_EXIT);
+		return REACTOR_CONTINUE;
+	}
+	if (cmd == USBMS_STANDBY_CMD_QUIT) {
+		LOG(LOG_INFO, "Leaving standby");
+		standby_reply(cfd, EXIT_SUCCESS);
+		return WAIT_QUIT;
+	} else if (cmd != USBMS_STANDBY_CMD_START) {
+		LOG(LOG_WARNING, "Ignoring unknown standby command %#hhx", cmd);
+		close(cfd);
+		return REACTOR_CONTINUE;
+	}
+
+	if (standby->memcheck == -1) {
+		if (load_fonts(standby->ctx, standby->abs_pwd, standby->is_CJK) != EXIT_SUCCESS) {
+			standby_reply(cfd, USBMS_EARLY_EXIT);
+			return REACTOR_CONTINUE;
+		}
+		standby->memcheck = reactor_add_timeout(
+		    reactor, USBMS_STANDBY_MEMCHECK_MS, USBMS_STANDBY_MEMCHECK_MS, &on_standby_memcheck, standby);
+	}
+
+	pid_t pid = fork();
+	if (pid == -1) {
+		PFLOG(LOG_WARNING, "fork: %m");
+		standby_reply(cfd, USBMS_EARLY_EXIT);
+		return REACTOR_CONTINUE;
+	} else if (pid == 0) {
+		close(cfd);
+		return WAIT_SESSION;
+	}
+
+	// NOTE: We'll reply once it's over (c.f., on_standby_exit), in the meantime, we keep serving requests.
+	standby->pid = pid;
+	standby->cfd = cfd;
+	return REACTOR_CONTINUE;
+}
+
+// Relay a session's exit code to its client once it's over (c.f., run_standby)
+static int
+    on_standby_exit(USBMSReactor* reactor __attribute__((unused)),
+		    int           fd,
+		    uint32_t      events __attribute__((unused)),
+		    void*         data)
+{
+	USBMSStandby* standby = data;
+	int           status  = 0;
+	if (standby->pid == -1) {
+		// NOTE: Not one of ours (i.e., nothing to reap), just drain it
+		struct signalfd_siginfo si;
+		while (read(fd, &si, sizeof(si)) == sizeof(si)) {
+			;
+		}
+		return REACTOR_CONTINUE;
+	}
+	if (!reap_child(fd, standby->pid, &status)) {
+		return REACTOR_CONTINUE;
+	}
+
+	unsigned char reply = EXIT_SUCCESS;
+	if (WIFEXITED(status)) {
+		reply = (unsigned char) WEXITSTATUS(status);
+	} else {
+		LOG(LOG_WARNING, "Session was terminated by signal %s", strsignal(WTERMSIG(status)));
+		reply = EXIT_FAILURE;
 	}
+	LOG(LOG_INFO, "Session exited with status %hhu, back on standby", reply);
+	standby_reply(standby->cfd, reply);
+	standby->pid = -1;
+	standby->cfd = -1;
+	return REACTOR_CONTINUE;
+}
 
-	return EXIT_FAILURE;
+// Warm standby (c.f., USBMS_STANDBY): with everything preloaded, wait for KOReader to ask for a session,
+// and fork a child to run each of them, so that every session still starts from the exact same state.
+// The protocol is a single byte each way over USBMS_STANDBY_SOCKET: a command, then, for a session,
+// its exit code once it's over (i.e., what KOReader would have gotten from a one-shot run).
+// NOTE: Everything goes through a reactor of our own, including reaping the sessions (via a signalfd),
+//       so that a live session never keeps us from answering requests, or from keeping an eye on memory pressure.
+// Returns USBMS_STANDBY_SESSION in said child (which should just carry on with the session), or our exit code.
+__attribute__((nonnull)) static int
+    run_standby(USBMSContext* ctx, const char* abs_pwd, bool is_CJK)
+{
+	int          rv      = USBMS_EARLY_EXIT;
+	USBMSReactor reactor = REACTOR_INITIALIZER;
+	int          chldfd  = -1;
+	USBMSStandby standby = {
+		.ctx = ctx, .abs_pwd = abs_pwd, .is_CJK = is_CJK, .sfd = -1, .memcheck = -1, .pid = -1, .cfd = -1
+	};
+
+	// Block SIGCHLD so we can get it through a signalfd instead (c.f., run_child)
+	sigset_t mask;
+	sigset_t old_mask;
+	sigemptyset(&mask);
+	sigaddset(&mask, SIGCHLD);
+	sigprocmask(SIG_BLOCK, &mask, &old_mask);
+
+	standby.sfd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (standby.sfd == -1) {
+		PFLOG(LOG_CRIT, "socket: %m");
+		sigprocmask(SIG_SETMASK, &old_mask, NULL);
+		return rv;
+	}
+	struct sockaddr_un addr = { .sun_family = AF_UNIX };
+	snprintf(addr.sun_path, sizeof(addr.sun_path), "%s", USBMS_STANDBY_SOCKET);
+	// Take over from a dead server
+	unlink(USBMS_STANDBY_SOCKET);
+	if (bind(standby.sfd, (const struct sockaddr*) &addr, sizeof(addr)) == -1) {
+		PFLOG(LOG_CRIT, "bind: %m");
+		close(standby.sfd);
+		sigprocmask(SIG_SETMASK, &old_mask, NULL);
+		return rv;
+	}
+	if (listen(standby.sfd, 1) == -1) {
+		PFLOG(LOG_CRIT, "listen: %m");
+		goto cleanup;
+	}
+	chldfd = signalfd(-1, &mask, SFD_NONBLOCK | SFD_CLOEXEC);
+	if (chldfd == -1) {
+		PFLOG(LOG_CRIT, "signalfd: %m");
+		goto cleanup;
+	}
+
+	// NOTE: We only ever wake up on our own to check on memory pressure,
+	//       and only as long as we still have something to give back.
+	if (reactor_init(&reactor) == -1 ||
+	    reactor_add(&reactor, standby.sfd, EPOLLIN, &on_standby_request, &standby) == -1 ||
+	    reactor_add(&reactor, chldfd, EPOLLIN, &on_standby_exit, &standby) == -1) {
+		goto cleanup;
+	}
+	standby.memcheck = reactor_add_timeout(
+	    &reactor, USBMS_STANDBY_MEMCHECK_MS, USBMS_STANDBY_MEMCHECK_MS, &on_standby_memcheck, &standby);
+	LOG(LOG_INFO, "On standby, waiting for session requests on `%s`", USBMS_STANDBY_SOCKET);
+
+	int outcome = reactor_run(&reactor);
+	if (outcome == WAIT_SESSION) {
+		// We're the session's child: the server's fds aren't ours to keep, nor is the socket ours to remove
+		reactor_close(&reactor);
+		close(chldfd);
+		close(standby.sfd);
+		sigprocmask(SIG_SETMASK, &old_mask, NULL);
+		// The session starts now
+		trace_init();
+		LOG(LOG_INFO, "Starting a session from standby");
+		return USBMS_STANDBY_SESSION;
+	} else if (outcome == WAIT_QUIT) {
+		rv = EXIT_SUCCESS;
+	}
+
+cleanup:
+	reactor_close(&reactor);
+	if (chldfd != -1) {
+		close(chldfd);
+	}
+	close(standby.sfd);
+	unlink(USBMS_STANDBY_SOCKET);
+	sigprocmask(SIG_SETMASK, &old_mask, NULL);
+
+	return rv;
+}
+
+// Find the input devices we care about (c.f., probe_device)
+static void
+    scan_input_devices(USBMSProbe* probe)
+{
+	// Auto-detect the input device for the power button
+	// NOTE: Not trace_begin, as session_trace belongs to the main thread, which will pick this up after the join.
+	struct timespec   scan_ts = { 0 };
+	clock_gettime(CLOCK_MONOTONIC, &scan_ts);
+	size_t            dev_count;
+	size_t            matches = 0U;
+	// Look for a power button that isn't featured by a touchscreen (because some panels have *extremely* weird caps...).
+	FBInkInputDevice* devices = fbink_input_scan(INPUT_POWER_BUTTON, INPUT_TOUCHSCREEN, SCAN_ONLY, &dev_count);
+	if (devices) {
+		FBInkInputDevice* matched_device = NULL;
+		for (FBInkInputDevice* device = devices; device < devices + dev_count; device++) {
+			// We *should* only ever get one match, but let's be extra cautious...
+			if (device->matched) {
+				matches++;
+				matched_device = device;
+			}
+			// Also handle the weird input device for the standalone USB-C controller found on some sunxi-era devices...
+			if (device->type == INPUT_UNKNOWN && strcmp(device->name, "P15USB30216C") == 0) {
+				USBC_EVDEV = arena_printf("%s", device->path);
+				LOG(LOG_INFO, "Found a standalone USB-C controller input device @ `%s`", device->path);
+				// We need to poke at a dev_attr of this virtual input device, which means we need its number...
+				USBC_PLUG_SYSFS =
+				    arena_printf(SUNXI_USBC_PLUG_SYSFS_FMT, device->path + strlen("/dev/input/event"));
+				// Double check that we indeed have a sysfs entry at the computed path...
+				if (USBC_PLUG_SYSFS) {
+					if (access(USBC_PLUG_SYSFS, F_OK) == 0) {
+						LOG(LOG_INFO,
+						    "Found USB_PLUG sysfs entry for standalone USB-C controller @ `%s`",
+						    USBC_PLUG_SYSFS);
+					} else {
+						LOG(LOG_WARNING,
+						    "Unable to access USB_PLUG sysfs entry for standalone USB-C controller @ `%s`",
+						    USBC_PLUG_SYSFS);
+						// We'll have to do without...
+						USBC_PLUG_SYSFS = NULL;
+					}
+				} else {
+					LOG(LOG_WARNING,
+					    "Failed to compute USB_PLUG sysfs entry for standalone USB-C controller!");
+				}
+			}
+		}
+		if (matches > 1U) {
+			// We pick the last one by virtue of event0 being fairly solidly set in stone as the main NTX key hub.
+			// If there's a dedicated power button, it'll come later.
+			LOG(LOG_WARNING,
+			    "Found more that one potential match for the power button's input device, picking the last one…");
+		}
+		if (matched_device) {
+			NTX_KEYS_EVDEV = arena_printf("%s", matched_device->path);
+			// For the probe cache's sake
+			snprintf(probe->ntx_keys_name, sizeof(probe->ntx_keys_name), "%s", matched_device->name);
+		}
+		free(devices);
+	}
+	if (matches == 0U) {
+		LOG(LOG_WARNING, "Couldn't auto-detect the power button's input device, assuming event0…");
+		NTX_KEYS_EVDEV = arena_printf("%s", "/dev/input/event0");
+	}
+	probe->input_scan_us = trace_elapsed_us(&scan_ts);
+}
+
+// NOTE: The NXP ones are only a starting point, as those boards come in a lot of different flavors
+//       (c.f., probe_sysfs).
+static const USBMSBackend usbms_backends[BACKEND_COUNT] = {
+	[BACKEND_NXP] = {
+		.id             = BACKEND_NXP,
+		.name           = "nxp",
+		.batt_cap       = NXP_BATT_CAP_SYSFS,
+		.charger_type   = NXP_CHARGER_TYPE_SYSFS,
+		.is_usb_plugged = &ioctl_is_usb_plugged,
+	},
+	[BACKEND_MK9] = {
+		.id             = BACKEND_MK9,
+		.name           = "mk9",
+		.batt_cap       = SUNXI_BATT_CAP_SYSFS,
+		.batt_status    = SUNXI_BATT_STATUS_SYSFS,
+		.charger_type   = NXP_CHARGER_TYPE_SYSFS,
+		.is_usb_plugged = &sysfs_is_usb_plugged,
+	},
+	// The CM_USB_Plug_IN ioctl is currently unreliable (it pokes at the wrong power supply)…
+	// NOTE: On the upside, it doesn't crash the kernel like on MTK ;o).
+	[BACKEND_SUNXI] = {
+		.id             = BACKEND_SUNXI,
+		.name           = "sunxi",
+		.batt_cap       = SUNXI_BATT_CAP_SYSFS,
+		.batt_status    = SUNXI_BATT_STATUS_SYSFS,
+		.charger_type   = SUNXI_CHARGER_TYPE_SYSFS,
+		.is_usb_plugged = &sysfs_is_usb_plugged,
+	},
+	// The CM_USB_Plug_IN ioctl still doesn't look at the right power supplies...
+	// NOTE: And will actually crash the kernel if you attempt it!
+	[BACKEND_MTK] = {
+		.id             = BACKEND_MTK,
+		.name           = "mtk",
+		.batt_cap       = MTK_BATT_CAP_SYSFS,
+		.batt_status    = MTK_BATT_STATUS_SYSFS,
+		.charger_type   = MTK_CHARGER_TYPE_SYSFS,
+		.is_usb_plugged = &sysfs_is_usb_plugged,
+	},
+};
+
+// Pick the right backend for this device (c.f., probe_device)
+static void
+    probe_sysfs(const USBMSProbe* probe)
+{
+	if (probe->fbink_state->is_mtk) {
+		usbms_backend = usbms_backends[BACKEND_MTK];
+		LOG(LOG_INFO, "Using the MTK battery status sysfs entry to handle cable sensing");
+	} else if (probe->fbink_state->is_sunxi) {
+		usbms_backend = usbms_backends[BACKEND_SUNXI];
+		LOG(LOG_INFO, "Using the sunxi battery status sysfs entry to handle cable sensing");
+	} else {
+		// NOTE: Mk. 9 devices may have different hardware revisions with meaningful changes,
+		//       and/or different hardware than earlier NTX boards, period;
+		//       so we'll just auto-detect everything...
+
+		// Using the new battery & charger sysfs paths
+		if (access(SUNXI_BATT_CAP_SYSFS, F_OK) == 0) {
+			usbms_backend = usbms_backends[BACKEND_MK9];
+
+			// NOTE: That doesn't necessarily mean the ioctl is broken, though...
+			//       Indeed, to make things spicier, with the BD71828 PMIC, the ioctl will be more accurate,
+			//       because it checks for POWER_SUPPLY_PROP_ONLINE instead of POWER_SUPPLY_PROP_STATUS,
+			//       and we've definitely seen examples where STATUS will say "Discharging" just after a plug-in event...
+			//       c.f., https://github.com/koreader/koreader/issues/12128
+			// As a cheap initial test, check if the ioctl currently returns 1, which probably means it works...
+			// ...assuming we're already plugged in, of course ;).
+			if (ioctl_is_usb_plugged(probe->ntxfd, false)) {
+				usbms_backend.is_usb_plugged = &ioctl_is_usb_plugged;
+				LOG(LOG_INFO, "Using the NTX ioctl to handle cable sensing");
+			} else if (access(ROHM_USB_ONLINE_SYSFS, F_OK) == 0) {
+				// Otherwise, check if we've actually got a psy named usb...
+				usbms_backend.usb_online     = ROHM_USB_ONLINE_SYSFS;
+				usbms_backend.is_usb_plugged = &sysfs_is_usb_online;
+				LOG(LOG_INFO, "Using the usb online sysfs entry to handle cable sensing");
+			} else {
+				LOG(LOG_INFO, "Using the battery status sysfs entry to handle cable sensing");
+			}
+		} else {
+			usbms_backend = usbms_backends[BACKEND_NXP];
+			LOG(LOG_INFO, "Using the NTX ioctl to handle cable sensing");
+		}
+
+		if (access(SUNXI_CHARGER_TYPE_SYSFS, F_OK) == 0) {
+			usbms_backend.charger_type = SUNXI_CHARGER_TYPE_SYSFS;
+		} else if (access(STD_CHARGER_TYPE_SYSFS, F_OK) == 0) {
+			usbms_backend.charger_type = STD_CHARGER_TYPE_SYSFS;
+		}
+	}
+	LOG(LOG_INFO, "Using the %s platform backend", usbms_backend.name);
+	// Check whether the device actually supports charger_type...
+	if (access(usbms_backend.charger_type, F_OK) != 0) {
+		LOG(LOG_INFO,
+		    "Unable to check charger type on your device (please report this issue if your device is actually newer than Mk. 7).");
+		// Lets us quickly check whether this is supported later
+		usbms_backend.charger_type = NULL;
+	}
+}
+
+// The sysfs paths we cache, and the only values we'll accept for each of them (c.f., load_probe_cache)
+static const char* const batt_cap_paths[]     = { NXP_BATT_CAP_SYSFS, SUNXI_BATT_CAP_SYSFS, MTK_BATT_CAP_SYSFS };
+static const char* const batt_status_paths[]  = { SUNXI_BATT_STATUS_SYSFS, MTK_BATT_STATUS_SYSFS };
+static const char* const usb_online_paths[]   = { ROHM_USB_ONLINE_SYSFS };
+static const char* const charger_type_paths[] = { NXP_CHARGER_TYPE_SYSFS,
+						  SUNXI_CHARGER_TYPE_SYSFS,
+						  STD_CHARGER_TYPE_SYSFS,
+						  MTK_CHARGER_TYPE_SYSFS };
+static const struct
+{
+	const char*        key;
+	const char**       path;
+	const char* const* candidates;
+	size_t             count;
+} probe_cache_paths[] = {
+	{     "batt_cap",     &usbms_backend.batt_cap,     batt_cap_paths,         sizeof(batt_cap_paths) / sizeof(*batt_cap_paths) },
+	{  "batt_status",  &usbms_backend.batt_status,  batt_status_paths,   sizeof(batt_status_paths) / sizeof(*batt_status_paths) },
+	{   "usb_online",   &usbms_backend.usb_online,   usb_online_paths,     sizeof(usb_online_paths) / sizeof(*usb_online_paths) },
+	{ "charger_type", &usbms_backend.charger_type, charger_type_paths, sizeof(charger_type_paths) / sizeof(*charger_type_paths) },
+};
+#define PROBE_CACHE_PATHS (sizeof(probe_cache_paths) / sizeof(*probe_cache_paths))
+
+// The cable sensing backends, by name
+static const struct
+{
+	const char* name;
+	bool (*fxp)(int, bool);
+} cable_sense_backends[] = {
+	{          "ioctl", &ioctl_is_usb_plugged },
+	{ "battery_status", &sysfs_is_usb_plugged },
+	{     "usb_online",  &sysfs_is_usb_online },
+};
+#define CABLE_SENSE_BACKENDS (sizeof(cable_sense_backends) / sizeof(*cable_sense_backends))
+
+// Check that an evdev node is still the input device we think it is
+__attribute__((nonnull)) static bool
+    is_evdev_named(const char* evdev, const char* name)
+{
+	const char* node = strrchr(evdev, '/');
+	if (!node) {
+		return false;
+	}
+	char path[PATH_MAX] = { 0 };
+	snprintf(path, sizeof(path), SYSFS_ROOT "/class/input%s/device/name", node);
+	FILE* f = fopen(path, "re");
+	if (!f) {
+		return false;
+	}
+	char dev_name[256] = { 0 };
+	bool match         = false;
+	if (fgets(dev_name, sizeof(dev_name), f)) {
+		dev_name[strcspn(dev_name, "\n")] = '\0';
+		match                             = strcmp(dev_name, name) == 0;
+	}
+	fclose(f);
+	return match;
+}
+
+// Dump what probe_device found out, so that the next launch can skip it (c.f., load_probe_cache)
+__attribute__((nonnull)) static void
+    save_probe_cache(const USBMSProbe* probe, const char* kernel)
+{
+	FILE* f = fopen(USBMS_PROBE_CACHE ".tmp", "we");
+	if (!f) {
+		LOG(LOG_WARNING, "Could not open the probe cache: %m");
+		return;
+	}
+	fprintf(f, "version=%d\n", USBMS_PROBE_CACHE_VERSION);
+	fprintf(f, "device_id=%hu\n", (unsigned short int) probe->fbink_state->device_id);
+	fprintf(f, "kernel=%s\n", kernel);
+	fprintf(f, "ntx_keys_evdev=%s\n", NTX_KEYS_EVDEV);
+	fprintf(f, "ntx_keys_name=%s\n", probe->ntx_keys_name);
+	fprintf(f, "usbc_evdev=%s\n", USBC_EVDEV ? USBC_EVDEV : "");
+	fprintf(f, "usbc_plug=%s\n", USBC_PLUG_SYSFS ? USBC_PLUG_SYSFS : "");
+	for (size_t i = 0U; i < PROBE_CACHE_PATHS; i++) {
+		fprintf(f, "%s=%s\n", probe_cache_paths[i].key, *probe_cache_paths[i].path ? *probe_cache_paths[i].path : "");
+	}
+	fprintf(f, "backend=%s\n", usbms_backend.name);
+	for (size_t i = 0U; i < CABLE_SENSE_BACKENDS; i++) {
+		if (cable_sense_backends[i].fxp == usbms_backend.is_usb_plugged) {
+			fprintf(f, "cable_sense=%s\n", cable_sense_backends[i].name);
+		}
+	}
+	// Write it atomically, so we never load a partial file
+	if (fclose(f) != 0 || rename(USBMS_PROBE_CACHE ".tmp", USBMS_PROBE_CACHE) == -1) {
+		LOG(LOG_WARNING, "Could not write the probe cache: %m");
+	}
+}
+
+// Restore what probe_device found out on a previous launch, provided it was on the same device, running the same kernel,
+// and that it all still checks out. Returns false if we need to probe the device ourselves.
+__attribute__((nonnull)) static bool
+    load_probe_cache(const USBMSProbe* probe, const char* kernel)
+{
+	FILE* f = fopen(USBMS_PROBE_CACHE, "re");
+	if (!f) {
+		return false;
+	}
+
+	char                line[PATH_MAX + 32U]     = { 0 };
+	char                ntx_keys_evdev[PATH_MAX] = { 0 };
+	char                ntx_keys_name[256]       = { 0 };
+	char                usbc_evdev[PATH_MAX]     = { 0 };
+	char                usbc_plug[PATH_MAX]      = { 0 };
+	const char*         paths[PROBE_CACHE_PATHS] = { 0 };
+	bool (*cable_sense)(int, bool)               = NULL;
+	const USBMSBackend* backend                  = NULL;
+	// One bit per key, so we can tell whether we've got all of them
+	uint32_t       seen  = 0U;
+	const uint32_t all   = (1U << (7U + PROBE_CACHE_PATHS + 2U)) - 1U;
+	bool           valid = true;
+	while (valid && fgets(line, sizeof(line), f)) {
+		line[strcspn(line, "\n")] = '\0';
+		char* value               = strchr(line, '=');
+		if (!value) {
+			valid = false;
+			break;
+		}
+		*value++ = '\0';
+
+		if (strcmp(line, "version") == 0) {
+			valid = strtol(value, NULL, 10) == USBMS_PROBE_CACHE_VERSION;
+			seen |= 1U << 0U;
+		} else if (strcmp(line, "device_id") == 0) {
+			valid = strtoul(value, NULL, 10) == probe->fbink_state->device_id;
+			seen |= 1U << 1U;
+		} else if (strcmp(line, "kernel") == 0) {
+			valid = strcmp(value, kernel) == 0;
+			seen |= 1U << 2U;
+		} else if (strcmp(line, "ntx_keys_evdev") == 0) {
+			snprintf(ntx_keys_evdev, sizeof(ntx_keys_evdev), "%s", value);
+			seen |= 1U << 3U;
+		} else if (strcmp(line, "ntx_keys_name") == 0) {
+			snprintf(ntx_keys_name, sizeof(ntx_keys_name), "%s", value);
+			seen |= 1U << 4U;
+		} else if (strcmp(line, "usbc_evdev") == 0) {
+			snprintf(usbc_evdev, sizeof(usbc_evdev), "%s", value);
+			seen |= 1U << 5U;
+		} else if (strcmp(line, "usbc_plug") == 0) {
+			snprintf(usbc_plug, sizeof(usbc_plug), "%s", value);
+			seen |= 1U << 6U;
+		} else if (strcmp(line, "cable_sense") == 0) {
+			for (size_t i = 0U; i < CABLE_SENSE_BACKENDS; i++) {
+				if (strcmp(value, cable_sense_backends[i].name) == 0) {
+					cable_sense = cable_sense_backends[i].fxp;
+				}
+			}
+			valid = cable_sense != NULL;
+			seen |= 1U << (7U + PROBE_CACHE_PATHS);
+		} else if (strcmp(line, "backend") == 0) {
+			for (size_t i = 0U; i < BACKEND_COUNT; i++) {
+				if (strcmp(value, usbms_backends[i].name) == 0) {
+					backend = &usbms_backends[i];
+				}
+			}
+			valid = backend != NULL;
+			seen |= 1U << (7U + PROBE_CACHE_PATHS + 1U);
+		} else {
+			size_t i = 0U;
+			for (; i < PROBE_CACHE_PATHS; i++) {
+				if (strcmp(line, probe_cache_paths[i].key) == 0) {
+					break;
+				}
+			}
+			if (i == PROBE_CACHE_PATHS) {
+				valid = false;
+				break;
+			}
+			// Only ever point those at one of our own constants
+			if (*value) {
+				for (size_t j = 0U; j < probe_cache_paths[i].count; j++) {
+					if (strcmp(value, probe_cache_paths[i].candidates[j]) == 0) {
+						paths[i] = probe_cache_paths[i].candidates[j];
+					}
+				}
+				valid = paths[i] != NULL && access(paths[i], F_OK) == 0;
+			}
+			seen |= 1U << (7U + i);
+		}
+	}
+	fclose(f);
+
+	// Check that the input devices are still where we left them
+	if (valid && seen == all) {
+		valid = ntx_keys_evdev[0] != '\0' && (ntx_keys_name[0] == '\0' || is_evdev_named(ntx_keys_evdev, ntx_keys_name));
+	}
+	if (valid && seen == all && usbc_evdev[0] != '\0') {
+		// NOTE: The controller's USB_PLUG attribute may legitimately be missing (c.f., scan_input_devices)
+		valid = is_evdev_named(usbc_evdev, "P15USB30216C") &&
+			(usbc_plug[0] == '\0' || access(usbc_plug, F_OK) == 0);
+	}
+	if (!valid || seen != all) {
+		LOG(LOG_INFO, "Discarding a stale probe cache");
+		return false;
+	}
+
+	NTX_KEYS_EVDEV = arena_printf("%s", ntx_keys_evdev);
+	if (usbc_evdev[0] != '\0') {
+		USBC_EVDEV      = arena_printf("%s", usbc_evdev);
+		USBC_PLUG_SYSFS = usbc_plug[0] != '\0' ? arena_printf("%s", usbc_plug) : NULL;
+	}
+	usbms_backend = *backend;
+	for (size_t i = 0U; i < PROBE_CACHE_PATHS; i++) {
+		*probe_cache_paths[i].path = paths[i];
+	}
+	usbms_backend.is_usb_plugged = cable_sense;
+	// NOTE: On Mk. 9, whether the ioctl was picked depends on whether we were plugged in when we probed,
+	//       so, give it another chance (that's a single ioctl).
+	if (usbms_backend.id == BACKEND_MK9 && usbms_backend.is_usb_plugged != &ioctl_is_usb_plugged &&
+	    ioctl_is_usb_plugged(probe->ntxfd, false)) {
+		usbms_backend.is_usb_plugged = &ioctl_is_usb_plugged;
+		LOG(LOG_INFO, "Using the NTX ioctl to handle cable sensing");
+	}
+	LOG(LOG_INFO,
+	    "Restored the hardware probe from the cache (%s backend, power button @ `%s`, USB-C controller @ `%s`)",
+	    usbms_backend.name,
+	    NTX_KEYS_EVDEV,
+	    USBC_EVDEV ? USBC_EVDEV : "N/A");
+	return true;
+}
+
+// Everything we need to know about the device before we can get going, but not to get the header on screen.
+// Runs on a helper thread (c.f., USBMSProbe), while the main thread does just that.
+// NOTE: Only touches its own globals (& the sysfs attribute cache), and only spawns children from there,
+//       so that we never have two run_child loops fighting over SIGCHLD.
+static void*
+    probe_device(void* data)
+{
+	USBMSProbe* probe                   = data;
+	char        resource_path[PATH_MAX] = { 0 };
+
+	// Make sure we have a klogd instance redirecting the kernel logs to syslog, so we get some context interleaved with our own logging.
+	snprintf(resource_path, sizeof(resource_path) - 1U, "%s/scripts/launch-klogd.sh", probe->abs_pwd);
+	run_child(&(const USBMSChild){ .name = "launch-klogd.sh", .argv = { resource_path }, .timeout = 10 });
+
+	// Unless we already did all that on a previous launch…
+	struct utsname uts = { 0 };
+	uname(&uts);
+	if (!load_probe_cache(probe, uts.release)) {
+		scan_input_devices(probe);
+		probe_sysfs(probe);
+		save_probe_cache(probe, uts.release);
+	}
+	setup_sysfs_attrs();
+
+	// Much like in KOReader's OTAManager, check if we can use pipefail in a roundabout way,
+	// because old busybox ash versions will *abort* on set failures…
+	// NOTE: Its output is just a complaint when it's unsupported, so, don't bother logging it.
+	int rc = run_child(&(const USBMSChild){ .name    = "pipefail check",
+						.argv    = { "/bin/sh", "-c", "set -o pipefail 2>/dev/null" },
+						.timeout = 5 });
+	// NOTE: The main thread exports it, as setenv isn't thread-safe
+	probe->with_pipefail = rc == EXIT_SUCCESS;
+
+	return NULL;
 }
 
 int
@@ -919,19 +4062,30 @@ int
 	struct libevdev* dev            = NULL;
 	USBMSContext     ctx            = { 0 };
 	int              evfd           = -1;
-	int              clockfd        = -1;
-	int              countdown_fd   = -1;
+	USBMSReactor     reactor        = REACTOR_INITIALIZER;
 	struct libevdev* usbc_dev       = NULL;
 	int              usbc_fd        = -1;
+	USBMSProbe       probe          = { 0 };
+	pthread_t        probe_thread;
+	bool             probe_running  = false;
+	sigset_t         sigchld_mask;
+	bool             standby        = !!getenv("USBMS_STANDBY");
+	bool             standby_server = false;
 
 	// Close any non-standard fds before we open any ourselves (this should be a NOP on sane launchers)
 	bsd_closefrom(3);
 
 	// We'll be chatting exclusively over syslog, because duh.
 	openlog("usbms", LOG_CONS | LOG_PID | LOG_NDELAY, LOG_DAEMON);
+#ifndef DEBUG
+	// NOTE: We log at LOG_DEBUG on every uevent & status bar tick, and the Kobo glibc's syslog mallocs every message,
+	//       so, keep those to Debug builds.
+	setlogmask(LOG_UPTO(LOG_INFO));
+#endif
 
 	// Say hello
 	LOG(LOG_INFO, "Initializing USBMS %s (%s)", USBMS_VERSION, USBMS_TIMESTAMP);
+	trace_init();
 
 	// Redirect stdin/stdout/stderr to /dev/null
 	int fd = open("/dev/null", O_RDONLY);
@@ -974,10 +4128,16 @@ int
 		goto cleanup;
 	}
 	char resource_path[PATH_MAX] = { 0 };
-
-	// Make sure we have a klogd instance redirecting the kernel logs to syslog, so we get some context interleaved with our own logging.
-	snprintf(resource_path, sizeof(resource_path) - 1U, "%s/scripts/launch-klogd.sh", abs_pwd);
-	system(resource_path);
+	// NOTE: We'd keep our PWD busy for the whole lifetime of the standby server,
+	//       which wouldn't fly on either of the partitions we export…
+	if (standby && abs_pwd &&
+	    (strncmp(abs_pwd, KOBO_MOUNTPOINT, strlen(KOBO_MOUNTPOINT)) == 0 ||
+	     strncmp(abs_pwd, KOBO_SD_MOUNTPOINT, strlen(KOBO_SD_MOUNTPOINT)) == 0)) {
+		LOG(LOG_CRIT,
+		    "Standby mode requires running from outside of the exported partitions (i.e., a tmpfs), aborting…");
+		rv = USBMS_EARLY_EXIT;
+		goto cleanup;
+	}
 
 	// NOTE: The font we ship only covers LGC scripts. Blacklist a few languages where we know it won't work,
 	//       based on KOReader's own language list (c.f., frontend/ui/language.lua).
@@ -995,9 +4155,7 @@ int
 			LOG(LOG_NOTICE, "Your language (%s) may be badly handled (CJK)!", lang);
 
 			// If we don't actually have a translation ready, don't set the CJK flag, and fallback to English.
-			snprintf(
-			    resource_path, sizeof(resource_path) - 1U, "%s/l10n/%s/LC_MESSAGES/usbms.mo", abs_pwd, lang);
-			if (access(resource_path, F_OK) == 0) {
+			if (tr_find(lang)) {
 				is_CJK = true;
 			} else {
 				LOG(LOG_NOTICE,
@@ -1008,28 +4166,12 @@ int
 		}
 	}
 
-	// NOTE: Setup gettext, with a rather nasty twist, because of Kobo's utter lack of sane locales setup:
-	//       In order to translate stuff, gettext needs a valid setlocale call to a locale that *isn't* C or POSIX.
-	//       Unfortunately, Kobo doesn't compile *any* locales…
-	//       The minimal LC_* category we need for our translation is LC_MESSAGES.
-	//       It requires SYS_LC_MESSAGES from the glibc (usually shipped in archive form on sane systems).
-	//       So, we build one manually (via localedef) from the en_US definitions, and set-it up in a bogus custom locale,
-	//       which we use for our LC_MESSAGES setlocale call.
-	//       We of course ship it, and we enforce our own l10n directory as the global locale search path…
-	//       Then, we can *finally* choose our translation language via the LANGUAGE env var…
-	//       c.f., https://stackoverflow.com/q/36857863
-	snprintf(resource_path, sizeof(resource_path) - 1U, "%s/l10n", abs_pwd);
-	// We can't touch the rootfs, so, teach the glibc about our awful workaround…
-	// (c.f., https://www.gnu.org/software/libc/manual/html_node/Locale-Names.html)
-	setenv("LOCPATH", resource_path, 1);
-	// Then, because gettext wants a setlocale call, let's give it one that's enough to get us translations,
-	// and minimal enough that we don't have to ship a crazy amount of useless locale stuff…
-	setlocale(LC_MESSAGES, "kobo");
-	// And now stuff can more or less start looking like a classic gettext setup…
-	bindtextdomain("usbms", resource_path);
-	textdomain("usbms");
-	// The whole locale shenanigan means more hand-holding is needed to enforce UTF-8…
-	bind_textdomain_codeset("usbms", "UTF-8");
+	// NOTE: Our translations are compiled in, so this is all it takes to pick one
+	//       (which saves us from having to teach the glibc about a hand-built locale, as Kobo doesn't ship *any*).
+	tr_lang = tr_find(getenv("LANGUAGE"));
+	if (tr_lang) {
+		LOG(LOG_INFO, "Using the %s translation", tr_lang->catalog);
+	}
 
 	// Setup FBInk
 	ctx.fbink_cfg.row         = -5;
@@ -1039,6 +4181,7 @@ int
 	// We'll want early errors to already go to syslog
 	fbink_update_verbosity(&ctx.fbink_cfg);
 
+	trace_begin(PHASE_FBINK_INIT);
 	if ((ctx.fbfd = fbink_open()) == ERRCODE(EXIT_FAILURE)) {
 		LOG(LOG_CRIT, "Could not open the framebuffer, aborting…");
 		rv = USBMS_EARLY_EXIT;
@@ -1049,82 +4192,15 @@ int
 		rv = USBMS_EARLY_EXIT;
 		goto cleanup;
 	}
+	trace_end(PHASE_FBINK_INIT);
 	LOG(LOG_INFO, "Initialized FBInk %s", fbink_version());
-
-	// Now that FBInk has been initialized, setup the USB product ID for the current device
-	fbink_get_state(&ctx.fbink_cfg, &ctx.fbink_state);
-	setup_usb_ids(ctx.fbink_state.device_id);
-
-	// Auto-detect the input device for the power button
-	size_t            dev_count;
-	size_t            matches = 0U;
-	// Look for a power button that isn't featured by a touchscreen (because some panels have *extremely* weird caps...).
-	FBInkInputDevice* devices = fbink_input_scan(INPUT_POWER_BUTTON, INPUT_TOUCHSCREEN, SCAN_ONLY, &dev_count);
-	if (devices) {
-		FBInkInputDevice* matched_device = NULL;
-		for (FBInkInputDevice* device = devices; device < devices + dev_count; device++) {
-			// We *should* only ever get one match, but let's be extra cautious...
-			if (device->matched) {
-				matches++;
-				matched_device = device;
-			}
-			// Also handle the weird input device for the standalone USB-C controller found on some sunxi-era devices...
-			if (device->type == INPUT_UNKNOWN && strcmp(device->name, "P15USB30216C") == 0) {
-				USBC_EVDEV = strdup(device->path);
-				LOG(LOG_INFO, "Found a standalone USB-C controller input device @ `%s`", USBC_EVDEV);
-				// We need to poke at a dev_attr of this virtual input device, which means we need its number...
-				char* p = NULL;
-				int   n =
-				    snprintf(p, 0, SUNXI_USBC_PLUG_SYSFS_FMT, device->path + strlen("/dev/input/event"));
-				if (n >= 0) {
-					size_t size = (size_t) n + 1U;
-					p           = malloc(size);
-					if (p) {
-						n = snprintf(p,
-							     size,
-							     SUNXI_USBC_PLUG_SYSFS_FMT,
-							     device->path + strlen("/dev/input/event"));
-						if (n < 0) {
-							free(p);
-						} else {
-							USBC_PLUG_SYSFS = p;
-						}
-					}
-				}
-				// Double check that we indeed have a sysfs entry at the computed path...
-				if (USBC_PLUG_SYSFS) {
-					if (access(USBC_PLUG_SYSFS, F_OK) == 0) {
-						LOG(LOG_INFO,
-						    "Found USB_PLUG sysfs entry for standalone USB-C controller @ `%s`",
-						    USBC_PLUG_SYSFS);
-					} else {
-						LOG(LOG_WARNING,
-						    "Unable to access USB_PLUG sysfs entry for standalone USB-C controller @ `%s`",
-						    USBC_PLUG_SYSFS);
-						// We'll have to do without...
-						free(USBC_PLUG_SYSFS);
-						USBC_PLUG_SYSFS = NULL;
-					}
-				} else {
-					LOG(LOG_WARNING,
-					    "Failed to compute USB_PLUG sysfs entry for standalone USB-C controller!");
-				}
-			}
-		}
-		if (matches > 1U) {
-			// We pick the last one by virtue of event0 being fairly solidly set in stone as the main NTX key hub.
-			// If there's a dedicated power button, it'll come later.
-			LOG(LOG_WARNING,
-			    "Found more that one potential match for the power button's input device, picking the last one…");
-		}
-		if (matched_device) {
-			NTX_KEYS_EVDEV = strdup(matched_device->path);
-		}
-		free(devices);
-	}
-	if (matches == 0U) {
-		LOG(LOG_WARNING, "Couldn't auto-detect the power button's input device, assuming event0…");
-		NTX_KEYS_EVDEV = strdup("/dev/input/event0");
+
+	// Now that FBInk has been initialized, setup the USB product ID for the current device
+	fbink_get_state(&ctx.fbink_cfg, &ctx.fbink_state);
+	setup_usb_ids(ctx.fbink_state.device_id);
+	// Enforce REAGL, since AUTO is not recommended on sunxi
+	if (ctx.fbink_state.is_sunxi) {
+		ctx.fbink_cfg.wfm_mode = WFM_REAGL;
 	}
 
 	// Setup the fd for ntx_io ioctls
@@ -1135,89 +4211,92 @@ int
 		goto cleanup;
 	}
 
-	// And setup the sysfs paths & usb check based on the device…
-	if (ctx.fbink_state.is_mtk) {
-		BATT_CAP_SYSFS     = MTK_BATT_CAP_SYSFS;
-		CHARGER_TYPE_SYSFS = MTK_CHARGER_TYPE_SYSFS;
-
-		// The CM_USB_Plug_IN ioctl still doesn't look at the right power supplies...
-		// NOTE: And will actually crash the kernel if you attempt it!
-		BATT_STATUS_SYSFS = MTK_BATT_STATUS_SYSFS;
-		fxpIsUSBPlugged   = &sysfs_is_usb_plugged;
-		LOG(LOG_INFO, "Using the MTK battery status sysfs entry to handle cable sensing");
-	} else if (ctx.fbink_state.is_sunxi) {
-		BATT_CAP_SYSFS     = SUNXI_BATT_CAP_SYSFS;
-		CHARGER_TYPE_SYSFS = SUNXI_CHARGER_TYPE_SYSFS;
-
-		// The CM_USB_Plug_IN ioctl is currently unreliable (it pokes at the wrong power supply)…
-		// NOTE: On the upside, it doesn't crash the kernel like on MTK ;o).
-		BATT_STATUS_SYSFS = SUNXI_BATT_STATUS_SYSFS;
-		fxpIsUSBPlugged   = &sysfs_is_usb_plugged;
-		LOG(LOG_INFO, "Using the sunxi battery status sysfs entry to handle cable sensing");
-
-		// Enforce REAGL, since AUTO is not recommended on sunxi
-		ctx.fbink_cfg.wfm_mode = WFM_REAGL;
+	// Deal with devices where fbink_wait_for_complete may timeout...
+	if (ctx.fbink_state.unreliable_wait_for) {
+		fxpWaitForUpdateComplete = &stub_wait_for_update_complete;
 	} else {
-		// NOTE: Mk. 9 devices may have different hardware revisions with meaningful changes,
-		//       and/or different hardware than earlier NTX boards, period;
-		//       so we'll just auto-detect everything...
+		fxpWaitForUpdateComplete = &fbink_wait_for_complete;
+	}
 
-		// Using the new battery & charger sysfs paths
-		if (access(SUNXI_BATT_CAP_SYSFS, F_OK) == 0) {
-			BATT_CAP_SYSFS = SUNXI_BATT_CAP_SYSFS;
+	// Probe the rest of the device on a helper thread, while we get something on screen
+	// NOTE: Keep SIGCHLD blocked on our end until it's done,
+	//       so that it can't get delivered (and discarded) here instead of reaching its run_child's signalfd.
+	probe.abs_pwd       = abs_pwd;
+	probe.fbink_state   = &ctx.fbink_state;
+	probe.ntxfd         = ctx.ntxfd;
+	probe.input_scan_us = -1L;
+	sigemptyset(&sigchld_mask);
+	sigaddset(&sigchld_mask, SIGCHLD);
+	pthread_sigmask(SIG_BLOCK, &sigchld_mask, NULL);
+	// NOTE: Don't let its stack default to RLIMIT_STACK (usually 8 MiB): glibc keeps it mapped in its stack cache
+	//       once the thread is joined, so lock_session would fault in & pin all of it.
+	pthread_attr_t probe_attr;
+	pthread_attr_init(&probe_attr);
+	int rc = pthread_attr_setstacksize(&probe_attr, MAX((size_t) USBMS_PROBE_STACK_SIZE, (size_t) PTHREAD_STACK_MIN));
+	if (rc != 0) {
+		errno = rc;
+		PFLOG(LOG_WARNING, "pthread_attr_setstacksize: %m");
+	}
+	rc = pthread_create(&probe_thread, &probe_attr, &probe_device, &probe);
+	pthread_attr_destroy(&probe_attr);
+	if (rc == 0) {
+		probe_running = true;
+	} else {
+		errno = rc;
+		PFLOG(LOG_WARNING, "pthread_create: %m");
+		LOG(LOG_NOTICE, "Probing the device before displaying anything");
+		probe_device(&probe);
+	}
 
-			BATT_STATUS_SYSFS = SUNXI_BATT_STATUS_SYSFS;
+	open_bundle(&ctx.bundle, abs_pwd);
+	if (load_fonts(&ctx, abs_pwd, is_CJK) != EXIT_SUCCESS) {
+		rv = USBMS_EARLY_EXIT;
+		goto cleanup;
+	}
+	// Display our header ASAP (the logo comes later, as decoding it isn't free),
+	// unless we're on standby, in which case the screen isn't ours to touch yet.
+	if (!standby) {
+		paint_header(&ctx, is_CJK);
+	}
 
-			// NOTE: That doesn't necessarily mean the ioctl is broken, though...
-			//       Indeed, to make things spicier, with the BD71828 PMIC, the ioctl will be more accurate,
-			//       because it checks for POWER_SUPPLY_PROP_ONLINE instead of POWER_SUPPLY_PROP_STATUS,
-			//       and we've definitely seen examples where STATUS will say "Discharging" just after a plug-in event...
-			//       c.f., https://github.com/koreader/koreader/issues/12128
-			// As a cheap initial test, check if the ioctl currently returns 1, which probably means it works...
-			// ...assuming we're already plugged in, of course ;).
-			if (ioctl_is_usb_plugged(ctx.ntxfd, false)) {
-				fxpIsUSBPlugged = &ioctl_is_usb_plugged;
-				LOG(LOG_INFO, "Using the NTX ioctl to handle cable sensing");
-			} else if (access(ROHM_USB_ONLINE_SYSFS, F_OK) == 0) {
-				// Otherwise, check if we've actually got a psy named usb...
-				USB_ONLINE_SYSFS = ROHM_USB_ONLINE_SYSFS;
-				fxpIsUSBPlugged  = &sysfs_is_usb_online;
-				LOG(LOG_INFO, "Using the usb online sysfs entry to handle cable sensing");
-			} else {
-				fxpIsUSBPlugged = &sysfs_is_usb_plugged;
-				LOG(LOG_INFO, "Using the battery status sysfs entry to handle cable sensing");
-			}
-		} else {
-			BATT_CAP_SYSFS  = NXP_BATT_CAP_SYSFS;
-			fxpIsUSBPlugged = &ioctl_is_usb_plugged;
-			LOG(LOG_INFO, "Using the NTX ioctl to handle cable sensing");
+	// We can't go any further without knowing our way around the device
+	if (probe_running) {
+		pthread_join(probe_thread, NULL);
+		probe_running = false;
+	}
+	trace_record(PHASE_INPUT_SCAN, probe.input_scan_us);
+	pthread_sigmask(SIG_UNBLOCK, &sigchld_mask, NULL);
+	setenv("WITH_PIPEFAIL", probe.with_pipefail ? "true" : "false", 1);
+
+	// Everything's preloaded, if we're on standby, wait for a session request
+	if (standby) {
+		rc = run_standby(&ctx, abs_pwd, is_CJK);
+		if (rc != USBMS_STANDBY_SESSION) {
+			// We're done serving requests
+			standby_server = true;
+			rv             = rc;
+			goto cleanup;
 		}
-
-		if (access(SUNXI_CHARGER_TYPE_SYSFS, F_OK) == 0) {
-			CHARGER_TYPE_SYSFS = SUNXI_CHARGER_TYPE_SYSFS;
-		} else if (access(STD_CHARGER_TYPE_SYSFS, F_OK) == 0) {
-			CHARGER_TYPE_SYSFS = STD_CHARGER_TYPE_SYSFS;
-		} else {
-			CHARGER_TYPE_SYSFS = NXP_CHARGER_TYPE_SYSFS;
+		// We're the session's child, on with the show!
+		// NOTE: KOReader may have changed the framebuffer setup (e.g., its rotation) since we initialized FBInk,
+		//       so make sure we paint with the current geometry (which also keys the logo cache).
+		rc = fbink_reinit(ctx.fbfd, &ctx.fbink_cfg);
+		if (rc < 0) {
+			LOG(LOG_CRIT, "Could not reinitialize FBInk, aborting…");
+			rv = USBMS_EARLY_EXIT;
+			goto cleanup;
 		}
-	}
-	// Check whether the device actually supports charger_type...
-	if (access(CHARGER_TYPE_SYSFS, F_OK) != 0) {
-		LOG(LOG_INFO,
-		    "Unable to check charger type on your device (please report this issue if your device is actually newer than Mk. 7).");
-		// Lets us quickly check whether this is supported later
-		CHARGER_TYPE_SYSFS = NULL;
-	}
-	// Deal with devices where fbink_wait_for_complete may timeout...
-	if (ctx.fbink_state.unreliable_wait_for) {
-		fxpWaitForUpdateComplete = &stub_wait_for_update_complete;
-	} else {
-		fxpWaitForUpdateComplete = &fbink_wait_for_complete;
+		fbink_get_state(&ctx.fbink_cfg, &ctx.fbink_state);
+		if (rc > 0) {
+			LOG(LOG_NOTICE, "The framebuffer setup changed while we were on standby (%#x)", (unsigned int) rc);
+			// Whatever we might have rendered with the previous geometry is stale, too
+			free_icon_cache(&ctx);
+		}
+		paint_header(&ctx, is_CJK);
 	}
 
 	// Setup libue
-	int rc = -1;
-	rc     = ue_init_listener(&listener);
+	rc = ue_init_listener(&listener);
 	if (rc < 0) {
 		LOG(LOG_CRIT, "Could not initialize libue listener (%d)", rc);
 		rv = USBMS_EARLY_EXIT;
@@ -1281,105 +4360,25 @@ int
 		LOG(LOG_INFO, "Initialized libevdev v%s for device `%s`", LIBEVDEV_VERSION, libevdev_get_name(usbc_dev));
 	}
 
-	// Much like in KOReader's OTAManager, check if we can use pipefail in a roundabout way,
-	// because old busybox ash versions will *abort* on set failures…
-	rc = system("set -o pipefail 2>/dev/null");
-	if (rc == EXIT_SUCCESS) {
-		setenv("WITH_PIPEFAIL", "true", 1);
-	} else {
-		setenv("WITH_PIPEFAIL", "false", 1);
-	}
 
-	// Setup the timer for clock ticks
-	clockfd = timerfd_create(CLOCK_REALTIME, TFD_NONBLOCK | TFD_CLOEXEC);
-	if (clockfd == -1) {
-		PFLOG(LOG_CRIT, "timerfd_create (clock): %m");
+	// Setup our event loop, which everything we wait on from now on goes through
+	if (reactor_init(&reactor) == -1) {
 		rv = USBMS_EARLY_EXIT;
 		goto cleanup;
 	}
-	// Arm it to get a tick on every minute, on the dot.
-	struct timespec now_ts = { 0 };
-	clock_gettime(CLOCK_REALTIME, &now_ts);
-	struct itimerspec clock_timer;
-	// NOTE: Setting an initial expiration time in the past is perfectly valid:
-	//       the fd will just be marked as readable immediately
-	//       (and compute an accurate amount of expirations, as if it had ticked all this time).
+	// And tick the clock (i.e., the status bar) on every minute, on the dot.
 	// Here, the next minute on the dot is good enough for us,
 	// so, just round the current timestamp up to the next multiple of 60.
-	clock_timer.it_value.tv_sec     = (now_ts.tv_sec + 60 - 1) / 60 * 60;
-	clock_timer.it_value.tv_nsec    = 0;
-	// Tick every minute
-	clock_timer.it_interval.tv_sec  = 60;
-	clock_timer.it_interval.tv_nsec = 0;
-	if (timerfd_settime(clockfd, TFD_TIMER_ABSTIME, &clock_timer, NULL) == -1) {
-		PFLOG(LOG_CRIT, "timerfd_settime (clock): %m");
-		rv = USBMS_EARLY_EXIT;
-		goto cleanup;
-	}
-
-	// And another one for countdown ticks
-	countdown_fd = timerfd_create(CLOCK_REALTIME, TFD_NONBLOCK | TFD_CLOEXEC);
-	if (countdown_fd == -1) {
-		PFLOG(LOG_CRIT, "timerfd_create (countdown): %m");
-		rv = USBMS_EARLY_EXIT;
-		goto cleanup;
-	}
-	// Arm it to get a tick on every second
-	struct itimerspec countdown_timer;
-	countdown_timer.it_value.tv_sec     = now_ts.tv_sec;
-	countdown_timer.it_value.tv_nsec    = 0;
-	// Tick every second
-	countdown_timer.it_interval.tv_sec  = 1;
-	countdown_timer.it_interval.tv_nsec = 0;
-	if (timerfd_settime(countdown_fd, TFD_TIMER_ABSTIME, &countdown_timer, NULL) == -1) {
-		PFLOG(LOG_CRIT, "timerfd_settime (countdown): %m");
+	struct timespec now_ts = { 0 };
+	clock_gettime(CLOCK_REALTIME, &now_ts);
+	const struct timespec next_minute = { (now_ts.tv_sec + 60 - 1) / 60 * 60, 0L };
+	if (reactor_add_timer(&reactor, CLOCK_REALTIME, &next_minute, 60L * 1000L, &on_clock_tick, &ctx) == -1) {
 		rv = USBMS_EARLY_EXIT;
 		goto cleanup;
 	}
 
-	// Display our header
-	ctx.fbink_cfg.no_refresh = true;
-	fbink_cls(ctx.fbfd, &ctx.fbink_cfg, NULL, false);
-	ctx.ot_cfg.margins.top = (short int) ctx.fbink_state.font_h;
-	ctx.ot_cfg.size_px     = (unsigned short int) (ctx.fbink_state.font_h * 2U);
-	snprintf(resource_path, sizeof(resource_path) - 1U, "%s/resources/fonts/CaskaydiaCove_NF.ttf", abs_pwd);
-	if (fbink_add_ot_font_v2(resource_path, FNT_REGULAR, &ctx.icon_cfg) != EXIT_SUCCESS) {
-		PFLOG(LOG_CRIT, "Could not load main font!");
-		rv = USBMS_EARLY_EXIT;
-		goto cleanup;
-	}
-	// NOTE: Minor hackery: instead of the custom LGC Nerdfont we ship, for CJK, use KOReader's own CJK font…
-	//       (The only remotely CJK-ish NerdFont available is M+, and it's more J than CJK ;)).
-	if (is_CJK) {
-		snprintf(
-		    resource_path, sizeof(resource_path) - 1U, "%s/resources/fonts/NotoSansCJKsc-Regular.otf", abs_pwd);
-		if (fbink_add_ot_font_v2(resource_path, FNT_REGULAR, &ctx.msg_cfg) != EXIT_SUCCESS) {
-			PFLOG(LOG_CRIT, "Could not load CJK font!");
-			rv = USBMS_EARLY_EXIT;
-			goto cleanup;
-		}
-		// The first ot_cfg print (title bar) actually requires CJK support, so point it at our CJK font…
-		ctx.ot_cfg.font = ctx.msg_cfg.font;
-	} else {
-		// If we don't need CJK support, we simply use the main font everywhere
-		ctx.ot_cfg.font  = ctx.icon_cfg.font;
-		ctx.msg_cfg.font = ctx.icon_cfg.font;
-	}
-	fbink_print_ot(ctx.fbfd, _("USB Mass Storage"), &ctx.ot_cfg, &ctx.fbink_cfg, NULL);
-	if (is_CJK) {
-		// Back to the main font, as this will only be used for the status bar from now on
-		ctx.ot_cfg.font = ctx.icon_cfg.font;
-	}
-	ctx.fbink_cfg.ignore_alpha  = true;
-	ctx.fbink_cfg.halign        = CENTER;
-	ctx.fbink_cfg.scaled_height = (short int) (ctx.fbink_state.screen_height / 10U);
-	ctx.fbink_cfg.row           = 3;
-	snprintf(resource_path, sizeof(resource_path) - 1U, "%s/resources/img/koreader.png", abs_pwd);
-	fbink_print_image(ctx.fbfd, resource_path, 0, 0, &ctx.fbink_cfg);
-	ctx.fbink_cfg.no_refresh  = false;
-	ctx.fbink_cfg.is_flashing = true;
-	fbink_refresh(ctx.fbfd, 0, 0, 0, 0, &ctx.fbink_cfg);
-	ctx.fbink_cfg.is_flashing = false;
+	// Now that the header is up, the logo
+	print_logo(&ctx, abs_pwd);
 
 	// Display a minimal status bar on screen
 	tzset();
@@ -1388,13 +4387,16 @@ int
 	ctx.ot_cfg.margins.top = (short int) -(ctx.fbink_state.font_h * 3U);
 	ctx.ot_cfg.padding     = HORI_PADDING;
 	print_status(&ctx);
+	// From now on, keep it ticking while we wait on children, too
+	spawn_ui.ctx     = &ctx;
+	spawn_ui.reactor = &reactor;
 
 	// Setup the center icon display
 	ctx.icon_cfg.size_px = (unsigned short int) (ctx.fbink_state.font_h * 30U);
 	ctx.icon_cfg.padding = HORI_PADDING;
 
 	// The various lsmod checks will take a while, so, start with the initial cable status…
-	bool usb_plugged = (*fxpIsUSBPlugged)(ctx.ntxfd, true);
+	bool usb_plugged = (*usbms_backend.is_usb_plugged)(ctx.ntxfd, true);
 	print_icon(usb_plugged ? "\U000f0201" : "\U000f0202", &ctx);
 
 	// Setup the message area
@@ -1412,6 +4414,7 @@ int
 	ctx.countdown_cfg.padding     = HORI_PADDING;
 
 	// And now, on to the fun stuff!
+	trace_begin(PHASE_BUSY_CHECK);
 	bool need_early_abort = false;
 	bool early_unmount    = false;
 	bool had_swap         = false;
@@ -1442,18 +4445,11 @@ int
 	// Try to cobble something together for configfs devices...
 	if (access(KOBO_USB_GADGET_STATE_MTK, F_OK) == 0) {
 		LOG(LOG_INFO, "Checking MTK USB gadget state");
-		FILE* f = fopen(KOBO_USB_GADGET_STATE_MTK, "re");
-		if (f) {
-			// The longest possible string happens to be exactly 15 characters
-			char   gadget_state[16] = { 0 };
-			size_t size = fread(gadget_state, sizeof(*gadget_state), sizeof(gadget_state) - 1U, f);
-			fclose(f);
-			if (size > 0) {
-				// Strip trailing LF (there shouldn't be any here)
-				if (gadget_state[size - 1U] == '\n') {
-					gadget_state[size - 1U] = '\0';
-				}
-			} else {
+		// The longest possible string happens to be exactly 15 characters
+		char    gadget_state[16] = { 0 };
+		ssize_t size             = read_sysfs_attr(ATTR_UDC_STATE, gadget_state, sizeof(gadget_state));
+		if (size != -1) {
+			if (size == 0) {
 				LOG(LOG_WARNING, "Could not read the gadget type from sysfs!");
 			}
 
@@ -1547,7 +4543,8 @@ int
 				}
 				fclose(swaps);
 				if (had_swap) {
-					rc = system("swapoff -a");
+					rc = run_child(
+					    &(const USBMSChild){ .name = "swapoff", .argv = { "swapoff", "-a" } });
 					if (rc != EXIT_SUCCESS) {
 						LOG(LOG_WARNING, "Failed to disable swap (rc: %d)!", rc);
 					}
@@ -1584,23 +4581,16 @@ int
 				ctx.msg_cfg.margins.bottom       = 0;
 
 				LOG(LOG_WARNING, "Listing all offending processes…");
-				snprintf(resource_path,
-					 sizeof(resource_path) - 1U,
-					 "%s/scripts/fuser-check.sh '%s'",
-					 abs_pwd,
-					 mount_points[i].mountpoint);
-				FILE* f = popen(resource_path, "re");
-				if (f) {
-					char line[PIPE_BUF];
-					while (fgets(line, sizeof(line), f)) {
-						rc                      = print_msg(line, &ctx);
-						ctx.msg_cfg.margins.top = (short int) rc;
-					}
-
+				snprintf(resource_path, sizeof(resource_path) - 1U, "%s/scripts/fuser-check.sh", abs_pwd);
+				rc = run_child(&(const USBMSChild){ .name    = "fuser-check.sh",
+								    .argv    = { resource_path, mount_points[i].mountpoint },
+								    .timeout = 30,
+								    .on_line = print_fuser_line,
+								    .data    = &ctx });
+				if (rc != -1) {
 					// Back to normal :)
 					ctx.msg_cfg.size_px = size_px;
 
-					rc = pclose(f);
 					if (rc != EXIT_SUCCESS) {
 						// Hu oh… Print a giant warning, and abort.
 						LOG(LOG_CRIT, "The fuser script failed (%d)!", rc);
@@ -1640,113 +4630,56 @@ int
 		}
 	}
 
+	trace_end(PHASE_BUSY_CHECK);
+
 	// If we need an early abort because of USBNet/USBSerial or a busy mountpoint, do it now…
 	if (need_early_abort) {
 		LOG(LOG_INFO, "Waiting for a power button press…");
-		struct pollfd pfds[3] = { 0 };
-		nfds_t        nfds    = 3;
-		// Input device
-		pfds[0].fd            = evfd;
-		pfds[0].events        = POLLIN;
-		// Clock
-		pfds[1].fd            = clockfd;
-		pfds[1].events        = POLLIN;
-		// Countdown
-		pfds[2].fd            = countdown_fd;
-		pfds[2].events        = POLLIN;
-
-		// Keep track of the time we've been polling via the countdown timerfd
-		// NOTE: Starting at -1 allows us to hold the initial countdown value on screen for slightly longer,
-		//       as the timerfd ticks on the actual second change (e.g., 1.000000),
-		//       while it's unlikely we'll be calling poll in sync with that ;).
-		time_t time_spent_polling = -1;
-		print_countdown(30, &ctx);
-
-		while (true) {
-			int poll_num = poll(pfds, nfds, 5 * 1000);
-
-			if (poll_num == -1) {
-				if (errno == EINTR) {
-					continue;
-				}
-				PFLOG(LOG_CRIT, "poll: %m");
-				rv = early_unmount ? EXIT_FAILURE : USBMS_EARLY_EXIT;
-				goto cleanup;
-			}
-
-			if (poll_num > 0) {
-				// Power button
-				if (pfds[0].revents & POLLIN) {
-					if (handle_evdev(dev)) {
-						// Refresh the status bar
-						print_status(&ctx);
-						LOG(LOG_NOTICE, "Caught a power button release");
-						// Clear the countdown, it may be halfway inside msg's margins
-						clear_countdown(&ctx);
-						if (early_unmount) {
-							print_msg(
-							    // @translators: First unicode codepoint is an icon, leave it as-is.
-							    _("\uf071 The device will shut down in 90 sec."),
-							    &ctx);
-						} else {
-							print_msg(
-							    // @translators: First unicode codepoint is an icon, leave it as-is.
-							    _("\uf05a KOReader will now restart…"),
-							    &ctx);
-						}
-						(*fxpWaitForUpdateComplete)(ctx.fbfd, LAST_MARKER);
-						break;
-					}
-				}
-
-				// Clock
-				if (pfds[1].revents & POLLIN) {
-					// Refresh the status bar
-					print_status(&ctx);
-					// We don't actually care about the expiration count, so just read to clear the event
-					uint64_t exp;
-					read(clockfd, &exp, sizeof(exp));
-				}
-
-				// Countdown
-				if (pfds[2].revents & POLLIN) {
-					time_spent_polling += 1;
-					time_t left         = MAX(0, 30 - time_spent_polling);
-					print_countdown(left, &ctx);
-					// We don't actually care about the expiration count, so just read to clear the event
-					uint64_t exp;
-					read(countdown_fd, &exp, sizeof(exp));
-				}
-			}
+		USBMSWait wait = {
+			.ctx = &ctx, .dev = dev, .evfd = evfd, .uefd = -1, .usbc_fd = -1, .udc_fd = -1, .countdown = 30
+		};
+		if (begin_wait(&reactor, &wait) == -1) {
+			rv = early_unmount ? EXIT_FAILURE : USBMS_EARLY_EXIT;
+			goto cleanup;
+		}
+		int outcome = reactor_run(&reactor);
+		end_wait(&reactor, &wait);
 
-			bool done = false;
-			if (time_spent_polling >= 30) {
-				// We've been polling for more than 30 sec, we're done
-				done = true;
+		if (outcome == WAIT_POWER_BUTTON) {
+			// Clear the countdown, it may be halfway inside msg's margins
+			clear_countdown(&ctx);
+			if (early_unmount) {
+				print_msg(
+				    // @translators: First unicode codepoint is an icon, leave it as-is.
+				    _("\uf071 The device will shut down in 90 sec."),
+				    &ctx);
+			} else {
+				print_msg(
+				    // @translators: First unicode codepoint is an icon, leave it as-is.
+				    _("\uf05a KOReader will now restart…"),
+				    &ctx);
 			}
-
+			(*fxpWaitForUpdateComplete)(ctx.fbfd, LAST_MARKER);
+		} else if (outcome == WAIT_COUNTDOWN) {
 			// Give up afer 30 sec
-			if (done) {
-				LOG(LOG_NOTICE, "It's been 30 sec, giving up");
-				// Clear the countdown, it may be halfway inside msg's margins
-				clear_countdown(&ctx);
-				if (early_unmount) {
-					print_msg(
-					    // @translators: First unicode codepoint is an icon, leave it as-is.
-					    _("\uf05a Gave up after 30 sec.\nThe device will shut down in 90 sec."),
-					    &ctx);
-				} else {
-					print_msg(
-					    // @translators: First unicode codepoint is an icon, leave it as-is.
-					    _("\uf05a Gave up after 30 sec.\nKOReader will now restart…"),
-					    &ctx);
-				}
-				// Make sure this message will be visible…
-				(*fxpWaitForUpdateComplete)(ctx.fbfd, LAST_MARKER);
-				const struct timespec zzz = { 2L, 500000000L };
-				nanosleep(&zzz, NULL);
-				break;
+			LOG(LOG_NOTICE, "It's been 30 sec, giving up");
+			// Clear the countdown, it may be halfway inside msg's margins
+			clear_countdown(&ctx);
+			if (early_unmount) {
+				print_msg(
+				    // @translators: First unicode codepoint is an icon, leave it as-is.
+				    _("\uf05a Gave up after 30 sec.\nThe device will shut down in 90 sec."),
+				    &ctx);
+			} else {
+				print_msg(
+				    // @translators: First unicode codepoint is an icon, leave it as-is.
+				    _("\uf05a Gave up after 30 sec.\nKOReader will now restart…"),
+				    &ctx);
 			}
+			// Make sure this message will be visible…
+			(*fxpWaitForUpdateComplete)(ctx.fbfd, LAST_MARKER);
+			const struct timespec zzz = { 2L, 500000000L };
+			nanosleep(&zzz, NULL);
 		}
 
 		// NOTE: Not a hard failure, we can (usually) safely go back to whatever we were doing before.
@@ -1755,182 +4688,83 @@ int
 	}
 
 	LOG(LOG_INFO, "Starting USBMS shenanigans");
+	trace_begin(PHASE_PLUG_WAIT);
 	bool sleep_on_abort = true;
 	// If we're not plugged in, wait for it (or abort early)
-	usb_plugged         = (*fxpIsUSBPlugged)(ctx.ntxfd, true);
+	usb_plugged         = (*usbms_backend.is_usb_plugged)(ctx.ntxfd, true);
 	// Check the standalone USB-C controller, too...
 	int usb_c_plugged   = is_usbc_plugged(true);
 	while (!usb_plugged) {
 		print_msg(_("Waiting to be plugged in…\nOr, press the power button to exit."), &ctx);
 
 		LOG(LOG_INFO, "Waiting for a plug in event or a power button press…");
-		struct pollfd pfds[5] = { 0 };
-		nfds_t        nfds    = 5;
-		// Input device
-		pfds[0].fd            = evfd;
-		pfds[0].events        = POLLIN;
-		// Uevent socket
-		pfds[1].fd            = listener.pfd.fd;
-		pfds[1].events        = listener.pfd.events;
-		// USB-C input device (optional)
-		pfds[2].fd            = usbc_fd;
-		pfds[2].events        = POLLIN;
-		// Clock
-		pfds[3].fd            = clockfd;
-		pfds[3].events        = POLLIN;
-		// Countdown
-		pfds[4].fd            = countdown_fd;
-		pfds[4].events        = POLLIN;
-
-		// Keep track of the time we've been polling via the countdown timerfd
-		time_t time_spent_polling = -1;
-		print_countdown(60, &ctx);
-
-		struct uevent uev;
-		while (true) {
-			int poll_num = poll(pfds, nfds, 5 * 1000);
-
-			if (poll_num == -1) {
-				if (errno == EINTR) {
-					continue;
-				}
-				PFLOG(LOG_CRIT, "poll: %m");
-				rv = early_unmount ? EXIT_FAILURE : USBMS_EARLY_EXIT;
-				goto cleanup;
+		USBMSWait wait = { .ctx           = &ctx,
+				   .dev           = dev,
+				   .usbc_dev      = usbc_dev,
+				   .listener      = &listener,
+				   .evfd          = evfd,
+				   .uefd          = listener.pfd.fd,
+				   .usbc_fd       = usbc_fd,
+				   .udc_fd        = -1,
+				   .uevents       = (1U << USB_EVENT_PLUG_POWER) | (1U << USB_EVENT_PLUG_HOST),
+				   .countdown     = 60,
+				   .usb_c_plugged = usb_c_plugged };
+		if (begin_wait(&reactor, &wait) == -1) {
+			rv = early_unmount ? EXIT_FAILURE : USBMS_EARLY_EXIT;
+			goto cleanup;
+		}
+		int outcome = reactor_run(&reactor);
+		end_wait(&reactor, &wait);
+		usb_c_plugged = wait.usb_c_plugged;
+
+		if (outcome == WAIT_POWER_BUTTON) {
+			if (early_unmount) {
+				print_msg(
+				    // @translators: First unicode codepoint is an icon, leave it as-is.
+				    _("\uf071 The device will shut down in 90 sec."),
+				    &ctx);
+			} else {
+				print_msg(
+				    // @translators: First unicode codepoint is an icon, leave it as-is.
+				    _("\uf05a KOReader will now restart…"),
+				    &ctx);
 			}
-
-			if (poll_num > 0) {
-				// Power button
-				if (pfds[0].revents & POLLIN) {
-					if (handle_evdev(dev)) {
-						// Refresh the status bar
-						print_status(&ctx);
-						LOG(LOG_NOTICE, "Caught a power button release");
-						if (early_unmount) {
-							print_msg(
-							    // @translators: First unicode codepoint is an icon, leave it as-is.
-							    _("\uf071 The device will shut down in 90 sec."),
-							    &ctx);
-						} else {
-							print_msg(
-							    // @translators: First unicode codepoint is an icon, leave it as-is.
-							    _("\uf05a KOReader will now restart…"),
-							    &ctx);
-						}
-						need_early_abort = true;
-						// That's a direct user interaction with an expected result, don't dawdle.
-						sleep_on_abort   = false;
-						break;
-					}
-				}
-
-				// Uevent
-				if (pfds[1].revents & POLLIN) {
-					int ue_rc = handle_uevent(&listener, &uev);
-					if (ue_rc == EXIT_SUCCESS) {
-						// Now check if it's a plug in…
-						if (uev.action == UEVENT_ACTION_ADD && uev.devpath &&
-						    UE_STR_EQ(uev.devpath, KOBO_USB_DEVPATH_PLUG)) {
-							// Refresh the status bar
-							print_status(&ctx);
-							LOG(LOG_WARNING,
-							    "Caught a plug in event, but to a plain power source, not a USB host");
-							if (early_unmount) {
-								print_msg(
-								    // @translators: First unicode codepoint is an icon, leave it as-is.
-								    _("\uf071 The device was plugged into a plain power source, not a USB host!\nThe device will shut down in 90 sec."),
-								    &ctx);
-							} else {
-								print_msg(
-								    // @translators: First unicode codepoint is an icon, leave it as-is.
-								    _("\uf071 The device was plugged into a plain power source, not a USB host!\nKOReader will now restart…"),
-								    &ctx);
-							}
-							need_early_abort = true;
-							break;
-						} else if (uev.action == UEVENT_ACTION_ADD && uev.devpath &&
-							   UE_STR_EQ(uev.devpath, KOBO_USB_DEVPATH_HOST)) {
-							// Refresh the status bar
-							print_status(&ctx);
-							LOG(LOG_NOTICE, "Caught a plug in event (to a USB host)");
-							break;
-						} else if (uev.action == UEVENT_ACTION_CHANGE && uev.subsystem &&
-							   UE_STR_EQ(uev.subsystem, "power_supply")) {
-							// Refresh the status bar
-							print_status(&ctx);
-							// NOTE: Any meaningful change *should* be accompanied by the relevant usb_host/usb_plug event,
-							//       this one is just for the status bar's sake.
-							// NOTE: That said, if we ever encounter weird cable sensing failures,
-							//       it *might* make sense to try to check POWER_SUPPLY_STATUS or POWER_SUPPLY_ONLINE
-							//       for specific POWER_SUPPLY_NAME in here?
-							//       Possibly with a bit of buffering to avoid surprises
-							//       (e.g., require two consecutive online > 0 or "Charging",
-							//       and reset the counter if not).
-							LOG(LOG_NOTICE, "Caught a discharge tick");
-						}
-					} else if (ue_rc == ERR_LISTENER_RECV) {
-						// Assume handle_uevent read failures to be fatal
-						rv = early_unmount ? EXIT_FAILURE : USBMS_EARLY_EXIT;
-						goto cleanup;
-					}
-				}
-
-				// Standalone USB-C controller
-				if (pfds[2].revents & POLLIN) {
-					// I don't trust this very much (even in optimal conditions, it *will* fire multiple times),
-					// but we've seen some weird behavior on some host/device combos,
-					// so, if that's the best we have at the end of the timeout, let the charger type detection figure it out...
-					usb_c_plugged = handle_usbc_evdev(usbc_dev);
-				}
-
-				// Clock
-				if (pfds[3].revents & POLLIN) {
-					// Refresh the status bar
-					print_status(&ctx);
-					// We don't actually care about the expiration count, so just read to clear the event
-					uint64_t exp;
-					read(clockfd, &exp, sizeof(exp));
-				}
-
-				// Countdown
-				if (pfds[4].revents & POLLIN) {
-					time_spent_polling += 1;
-					time_t left         = MAX(0, 60 - time_spent_polling);
-					print_countdown(left, &ctx);
-					// We don't actually care about the expiration count, so just read to clear the event
-					uint64_t exp;
-					read(countdown_fd, &exp, sizeof(exp));
-				}
+			need_early_abort = true;
+			// That's a direct user interaction with an expected result, don't dawdle.
+			sleep_on_abort   = false;
+		} else if (outcome == WAIT_UEVENT && wait.event == USB_EVENT_PLUG_POWER) {
+			LOG(LOG_WARNING, "Caught a plug in event, but to a plain power source, not a USB host");
+			if (early_unmount) {
+				print_msg(
+				    // @translators: First unicode codepoint is an icon, leave it as-is.
+				    _("\uf071 The device was plugged into a plain power source, not a USB host!\nThe device will shut down in 90 sec."),
+				    &ctx);
+			} else {
+				print_msg(
+				    // @translators: First unicode codepoint is an icon, leave it as-is.
+				    _("\uf071 The device was plugged into a plain power source, not a USB host!\nKOReader will now restart…"),
+				    &ctx);
 			}
-
-			bool done = false;
-			if (time_spent_polling >= 60) {
-				// We've been polling for more than 60 sec, we're done
-				done = true;
-
-				// Despite the lack of plug in event, check what the kernel thinks the current situation is...
-				usb_plugged = (*fxpIsUSBPlugged)(ctx.ntxfd, true);
-				if (usb_plugged && CHARGER_TYPE_SYSFS) {
-					// And in case it now looks plugged in, and we can verify that via a charger type check, keep going...
-					LOG(LOG_WARNING,
-					    "It's been 60 sec, and we failed to detect a proper plug in event, but the PMIC thinks we might be plugged in…");
-					break;
-				}
-
+			need_early_abort = true;
+		} else if (outcome == WAIT_UEVENT) {
+			LOG(LOG_NOTICE, "Caught a plug in event (to a USB host)");
+		} else if (outcome == WAIT_COUNTDOWN) {
+			// Despite the lack of plug in event, check what the kernel thinks the current situation is...
+			usb_plugged = (*usbms_backend.is_usb_plugged)(ctx.ntxfd, true);
+			if (usb_plugged && usbms_backend.charger_type) {
+				// And in case it now looks plugged in, and we can verify that via a charger type check, keep going...
+				LOG(LOG_WARNING,
+				    "It's been 60 sec, and we failed to detect a proper plug in event, but the PMIC thinks we might be plugged in…");
+			} else if (usb_c_plugged == 1 && usbms_backend.charger_type) {
 				// NOTE: In the same vein, on devices with a standalone USB-C controller,
 				//       if we failed to detect a proper plug in event,
 				//       but said controller thinks there's something at the other end of the cable,
 				//       go ahead and let the charger type detection figure things out...
-				if (usb_c_plugged == 1 && CHARGER_TYPE_SYSFS) {
-					// All the devices with said controller *should* support charger type detection, but let's be thorough...
-					LOG(LOG_WARNING,
-					    "It's been 60 sec, and we failed to detect a proper plug in event, but the USB-C controller thinks there's something at the other end of the cable…");
-					break;
-				}
-			}
-
-			// Give up afer 60 sec
-			if (done) {
+				// All the devices with said controller *should* support charger type detection, but let's be thorough...
+				LOG(LOG_WARNING,
+				    "It's been 60 sec, and we failed to detect a proper plug in event, but the USB-C controller thinks there's something at the other end of the cable…");
+			} else {
+				// Give up afer 60 sec
 				LOG(LOG_NOTICE, "It's been 60 sec, giving up");
 				if (early_unmount) {
 					print_msg(
@@ -1944,8 +4778,10 @@ int
 					    &ctx);
 				}
 				need_early_abort = true;
-				break;
 			}
+		} else {
+			rv = early_unmount ? EXIT_FAILURE : USBMS_EARLY_EXIT;
+			goto cleanup;
 		}
 
 		// Double-check what the USB-C controller thinks is going on...
@@ -1980,9 +4816,13 @@ int
 		//       the kernel ought to have better accuracy than the charger type check we'll do later...
 		//       (Specifically, right now, it makes the right decision if the charger type is SDP OVRLIM,
 		//       while that info is lost in the sysfs attribute).
-		const struct timespec zzz = { 2L, 0L };
-		nanosleep(&zzz, NULL);
-		usb_plugged = (*fxpIsUSBPlugged)(ctx.ntxfd, true);
+		// NOTE: The status bar keeps ticking in the meantime.
+		if (reactor_sleep(&reactor, 2L * 1000L) != WAIT_TIMER) {
+			LOG(LOG_ERR, "Failed to wait for the plug in to settle");
+			rv = early_unmount ? EXIT_FAILURE : USBMS_EARLY_EXIT;
+			goto cleanup;
+		}
+		usb_plugged = (*usbms_backend.is_usb_plugged)(ctx.ntxfd, true);
 		if (usb_plugged) {
 			// And that's our exit condition for the loop we're in
 			LOG(LOG_NOTICE, "Device is now plugged in");
@@ -2004,9 +4844,9 @@ int
 	//       assuming it *also* got a chance to catch the event: i.e., it started *before* the plug in…
 	// NOTE: Regardless, we want to double-check the charger type in *every* scenario...
 	// NOTE: Unfortunately, the only platforms where we can do that appears to be Mk. 7+…
-	if (CHARGER_TYPE_SYSFS) {
+	if (usbms_backend.charger_type) {
 		LOG(LOG_INFO, "Checking charger type");
-		FILE* f = fopen(CHARGER_TYPE_SYSFS, "re");
+		FILE* f = fopen(usbms_backend.charger_type, "re");
 		if (f) {
 			char   charger_type[16] = { 0 };
 			size_t size = fread(charger_type, sizeof(*charger_type), sizeof(charger_type) - 1U, f);
@@ -2100,6 +4940,8 @@ int
 		}
 	}
 
+	trace_end(PHASE_PLUG_WAIT);
+
 	// We're plugged in, here comes the fun…
 	LOG(LOG_INFO, "Starting USBMS session…");
 	print_icon("\uf287", &ctx);
@@ -2110,16 +4952,46 @@ int
 	uint8_t fl_intensity = get_frontlight_intensity();
 	LOG(LOG_INFO, "Frontlight intensity is currently set to %hhu%%", fl_intensity);
 
+	// Make sure nothing on our UI path will have to hit the disk once onboard is exported, if asked to
+	bool locked = !!getenv("USBMS_LOCKED_SESSION");
+	if (locked) {
+		trace_begin(PHASE_LOCK);
+		lock_session(&ctx, abs_pwd);
+		trace_end(PHASE_LOCK);
+	}
+
 	// Here goes nothing…
-	snprintf(resource_path,
-		 sizeof(resource_path) - 1U,
-		 "%s/scripts/start-usbms.sh >/usr/local/KoboUSBMS.log 2>&1",
-		 abs_pwd);
-	rc = system(resource_path);
-	if (rc != EXIT_SUCCESS) {
+	// NOTE: We handle this natively, unless asked not to (or unless we can't), in which case we fall back to the script.
+	bool         use_scripts = !!getenv("USBMS_USE_SCRIPTS");
+	USBMS_STEP_E step        = USBMS_STEP_OK;
+	rc                       = EXIT_SUCCESS;
+	trace_begin(PHASE_START_SESSION);
+	if (!use_scripts) {
+		step = start_usbms_session(&ctx);
+		if (step != USBMS_STEP_OK && step < USBMS_STEP_UMOUNT) {
+			LOG(LOG_WARNING,
+			    "Native USBMS session setup failed early (step: %s), falling back to the script",
+			    usbms_step_name(step));
+			use_scripts = true;
+		}
+	}
+	if (use_scripts) {
+		snprintf(resource_path, sizeof(resource_path) - 1U, "%s/scripts/start-usbms.sh", abs_pwd);
+		USBMSProgress    progress = { .ctx = &ctx, .msg = _("Starting USBMS session…") };
+		const USBMSChild script   = { .name        = "start-usbms.sh",
+					       .argv        = { resource_path },
+					       .on_progress = print_progress,
+					       .data        = &progress };
+		rc                        = run_child(&script);
+	}
+	trace_end(PHASE_START_SESSION);
+	session_trace.use_scripts = use_scripts;
+	if (rc != EXIT_SUCCESS || (!use_scripts && step != USBMS_STEP_OK)) {
 		// Hu oh… Print a giant warning, and abort. KOReader will shut down the device after a while.
-		if (rc == -1) {
-			LOG(LOG_CRIT, "Could not start the USBMS session (system: %m)!");
+		if (!use_scripts) {
+			LOG(LOG_CRIT, "Could not start the USBMS session (failed at step: %s)!", usbms_step_name(step));
+		} else if (rc == -1) {
+			LOG(LOG_CRIT, "Could not start the USBMS session (could not run the script)!");
 		} else {
 			if (WIFEXITED(rc)) {
 				LOG(LOG_CRIT,
@@ -2130,7 +5002,6 @@ int
 				    "Could not start the USBMS session (script was terminated by signal %s)!",
 				    strsignal(WTERMSIG(rc)));
 			}
-			LOG(LOG_DEBUG, "Check `/usr/local/KoboUSBMS.log` for more details");
 		}
 		print_icon("\uf06a", &ctx);
 		print_msg(
@@ -2165,87 +5036,31 @@ int
 
 	// And now we just have to wait until an unplug…
 	LOG(LOG_INFO, "Waiting for an eject or unplug event…");
-	struct pollfd pfds[3] = { 0 };
-	nfds_t        nfds    = 3;
-	// Uevent socket
-	pfds[0].fd            = listener.pfd.fd;
-	pfds[0].events        = listener.pfd.events;
-	// USB-C input device (optional)
-	pfds[1].fd            = usbc_fd;
-	pfds[1].events        = POLLIN;
-	// Clock
-	pfds[2].fd            = clockfd;
-	pfds[2].events        = POLLIN;
-
-	struct uevent uev;
-	// NOTE: This is basically ue_wait_for_event, but with an extra polling on our clock timerfd,
+	trace_begin(PHASE_HOST_SESSION);
+	// NOTE: This is basically ue_wait_for_event, but with the clock timer still ticking,
 	//       solely for the purpose of refreshing the status bar,
 	//       because we don't necessarily get change events on power_supply on older devices
 	//       (e.g., it happens on Mk. 7, but not on Mk. 5)…
-	while (true) {
-		int poll_num = poll(pfds, nfds, -1);
-
-		if (poll_num == -1) {
-			if (errno == EINTR) {
-				continue;
-			}
-			PFLOG(LOG_CRIT, "poll: %m");
-			rv = EXIT_FAILURE;
-			goto cleanup;
-		}
-
-		if (poll_num > 0) {
-			// Uevent
-			if (pfds[0].revents & POLLIN) {
-				int ue_rc = handle_uevent(&listener, &uev);
-				if (ue_rc == EXIT_SUCCESS) {
-					// Now check if it's an eject or an unplug…
-					if (uev.action == UEVENT_ACTION_OFFLINE && uev.devpath &&
-					    (UE_STR_EQ(uev.devpath, KOBO_USB_DEVPATH_FSL) ||
-					     (uev.modalias && UE_STR_EQ(uev.modalias, KOBO_USB_MODALIAS_CI)) ||
-					     UE_STR_EQ(uev.devpath, KOBO_USB_DEVPATH_UDC) ||
-					     UE_STR_EQ(uev.devpath, KOBO_USB_DEVPATH_MTK))) {
-						// Refresh the status bar
-						print_status(&ctx);
-						LOG(LOG_NOTICE, "Caught an eject event");
-						break;
-					} else if (uev.action == UEVENT_ACTION_REMOVE && uev.devpath &&
-						   (UE_STR_EQ(uev.devpath, KOBO_USB_DEVPATH_PLUG) ||
-						    UE_STR_EQ(uev.devpath, KOBO_USB_DEVPATH_HOST))) {
-						// Refresh the status bar
-						print_status(&ctx);
-						LOG(LOG_NOTICE, "Caught an unplug event");
-						break;
-					} else if (uev.action == UEVENT_ACTION_CHANGE && uev.subsystem &&
-						   UE_STR_EQ(uev.subsystem, "power_supply")) {
-						// Refresh the status bar
-						print_status(&ctx);
-						LOG(LOG_NOTICE, "Caught a charge tick");
-					}
-				} else if (ue_rc == ERR_LISTENER_RECV) {
-					// Assume handle_uevent read failures to be fatal
-					rv = EXIT_FAILURE;
-					goto cleanup;
-				}
-			}
-
-			// Standalone USB-C controller
-			if (pfds[1].revents & POLLIN) {
-				handle_usbc_evdev(usbc_dev);
-				// NOTE: Unlike with the plug in detection, this one is purely informal,
-				//       I don't intend to *ever* trust it over uevent for anything...
-			}
-
-			// Clock
-			if (pfds[2].revents & POLLIN) {
-				// Refresh the status bar
-				print_status(&ctx);
-				// We don't actually care about the expiration count, so just read to clear the event
-				uint64_t exp;
-				read(clockfd, &exp, sizeof(exp));
-			}
-		}
+	// NOTE: The UDC state (MTK only) is kept open since the initial gadget check, and it supports sysfs_notify.
+	USBMSWait wait = { .ctx      = &ctx,
+			   .usbc_dev = usbc_dev,
+			   .listener = &listener,
+			   .evfd     = -1,
+			   .uefd     = listener.pfd.fd,
+			   .usbc_fd  = usbc_fd,
+			   .udc_fd   = sysfs_attrs[ATTR_UDC_STATE].fd,
+			   .uevents  = (1U << USB_EVENT_EJECT) | (1U << USB_EVENT_UNPLUG) };
+	if (begin_wait(&reactor, &wait) == -1) {
+		rv = EXIT_FAILURE;
+		goto cleanup;
 	}
+	int outcome = reactor_run(&reactor);
+	end_wait(&reactor, &wait);
+	if (outcome != WAIT_UEVENT) {
+		rv = EXIT_FAILURE;
+		goto cleanup;
+	}
+	LOG(LOG_NOTICE, "Caught an %s event", wait.event == USB_EVENT_EJECT ? "eject" : "unplug");
 	// Remember the eject timestamp
 	struct timespec eject_ts = { 0 };
 	clock_gettime(CLOCK_REALTIME, &eject_ts);
@@ -2277,19 +5092,54 @@ int
 		goto cleanup;
 	}
 
+	trace_end(PHASE_HOST_SESSION);
+#ifdef USBMS_MALLOC_STATS
+	// NOTE: Only the status bar redraws are expected to show up here (FBInk's OT renderer allocates on every call)
+	LOG(LOG_INFO,
+	    "Heap allocations during the host session: %lu (%lu frees)",
+	    alloc_stats[PHASE_HOST_SESSION].allocs,
+	    alloc_stats[PHASE_HOST_SESSION].frees);
+#endif
+
 	// And now remount all the things!
 	LOG(LOG_INFO, "Ending USBMS session…");
 	print_icon("\U000f0553", &ctx);
 	print_msg(_("Ending USBMS session…"), &ctx);
 
 	// Nearly there…
-	snprintf(
-	    resource_path, sizeof(resource_path) - 1U, "%s/scripts/end-usbms.sh >/usr/local/KoboUSBMS.log 2>&1", abs_pwd);
-	rc = system(resource_path);
-	if (rc != EXIT_SUCCESS) {
+	// NOTE: Stick to the script if that's what we used to setup the session.
+	rc   = EXIT_SUCCESS;
+	step = USBMS_STEP_OK;
+	trace_begin(PHASE_END_SESSION);
+	if (!use_scripts) {
+		step = end_usbms_session();
+		if (step != USBMS_STEP_OK && step < USBMS_STEP_UMOUNT) {
+			LOG(LOG_WARNING,
+			    "Native USBMS session teardown failed early (step: %s), falling back to the script",
+			    usbms_step_name(step));
+			use_scripts = true;
+		}
+	}
+	if (use_scripts) {
+		snprintf(resource_path, sizeof(resource_path) - 1U, "%s/scripts/end-usbms.sh", abs_pwd);
+		USBMSProgress    progress = { .ctx = &ctx, .msg = _("Ending USBMS session…") };
+		const USBMSChild script   = { .name        = "end-usbms.sh",
+					       .argv        = { resource_path },
+					       .on_progress = print_progress,
+					       .data        = &progress };
+		rc                        = run_child(&script);
+	}
+	trace_end(PHASE_END_SESSION);
+	// Onboard is back, the page cache can go back to business as usual
+	if (locked) {
+		unlock_session(&ctx);
+	}
+	if (rc != EXIT_SUCCESS || (!use_scripts && step != USBMS_STEP_OK)) {
 		// Hu oh… Print a giant warning, and abort. KOReader will shut down the device after a while.
-		if (rc == -1) {
-			LOG(LOG_CRIT, "Could not end the USBMS session (system: %m)!");
+		if (!use_scripts) {
+			LOG(LOG_CRIT, "Could not end the USBMS session (failed at step: %s)!", usbms_step_name(step));
+		} else if (rc == -1) {
+			LOG(LOG_CRIT, "Could not end the USBMS session (could not run the script)!");
 		} else {
 			if (WIFEXITED(rc)) {
 				LOG(LOG_CRIT,
@@ -2300,7 +5150,6 @@ int
 				    "Could not end the USBMS session (script was terminated by signal %s)!",
 				    strsignal(WTERMSIG(rc)));
 			}
-			LOG(LOG_DEBUG, "Check `/usr/local/KoboUSBMS.log` for more details");
 		}
 		print_icon("\uf06a", &ctx);
 		print_msg(
@@ -2315,13 +5164,14 @@ int
 	// Restore swap if we had disabled it earlier
 	if (had_swap) {
 		LOG(LOG_INFO, "Re-enabling swap…");
-		rc = system("swapon -a");
+		rc = run_child(&(const USBMSChild){ .name = "swapon", .argv = { "swapon", "-a" }, .timeout = 30 });
 		if (rc != EXIT_SUCCESS) {
 			LOG(LOG_WARNING, "Failed to re-enable swap (rc: %d)!", rc);
 		}
 	}
 
 	// Handle date/time synchronization, like Nickel
+	trace_begin(PHASE_TIME_SYNC);
 	// c.f., https://www.mobileread.com/forums/showpost.php?p=4064358&postcount=9
 	if (access(KOBO_TZ_FILE, F_OK) == 0) {
 		LOG(LOG_INFO, "Checking timezone synchronization file…");
@@ -2447,6 +5297,8 @@ int
 		unlink(KOBO_EPOCH_TS);
 	}
 
+	trace_end(PHASE_TIME_SYNC);
+
 	// Whee!
 	LOG(LOG_INFO, "Done :)");
 	// NOTE: We batch the final screen, make it flash, and wait for completion of the refresh,
@@ -2464,17 +5316,22 @@ int
 	(*fxpWaitForUpdateComplete)(ctx.fbfd, LAST_MARKER);
 
 cleanup:
+	// If we bailed out while it was still probing, wait for it to be done with our stuff
+	if (probe_running) {
+		pthread_join(probe_thread, NULL);
+	}
+	trace_record(PHASE_INPUT_SCAN, probe.input_scan_us);
+	// NOTE: The standby server never runs a session itself, its children each dump their own
+	if (!standby_server) {
+		dump_trace(rv);
+	}
 	LOG(LOG_INFO, "Bye!");
 
-	fbink_free_ot_fonts_v2(&ctx.icon_cfg);
-	if (is_CJK) {
-		fbink_free_ot_fonts_v2(&ctx.msg_cfg);
-		ctx.ot_cfg.font = NULL;
-	} else {
-		// We share the same font everywhere, so just avoid dangling pointers
-		ctx.msg_cfg.font = NULL;
-		ctx.ot_cfg.font  = NULL;
-	}
+	free_icon_cache(&ctx);
+
+	free_fonts(&ctx, is_CJK);
+	close_bundle(&ctx.bundle);
+	unpin_files(&ctx);
 	fbink_close(ctx.fbfd);
 
 	ue_destroy_listener(&listener);
@@ -2483,24 +5340,18 @@ cleanup:
 	if (evfd != -1) {
 		close(evfd);
 	}
-	free(NTX_KEYS_EVDEV);
 	libevdev_free(usbc_dev);
 	if (usbc_fd != -1) {
 		close(usbc_fd);
 	}
-	free(USBC_EVDEV);
-	free(USBC_PLUG_SYSFS);
+	close_sysfs_attrs();
 
 	if (ctx.ntxfd != -1) {
 		close(ctx.ntxfd);
 	}
 
-	if (clockfd != -1) {
-		close(clockfd);
-	}
-	if (countdown_fd != -1) {
-		close(countdown_fd);
-	}
+	spawn_ui.reactor = NULL;
+	reactor_close(&reactor);
 
 	if (pwd != -1) {
 		if (fchdir(pwd) == -1) {
@@ -32,15 +32,26 @@
 #include <limits.h>
 #include <linux/limits.h>
 #include <linux/rtc.h>
+#include <malloc.h>
+#include <pthread.h>
+#include <signal.h>
+#include <spawn.h>
+#include <stdarg.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/epoll.h>
 #include <sys/ioctl.h>
+#include <sys/mman.h>
 #include <sys/mount.h>
+#include <sys/signalfd.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
 #include <sys/timerfd.h>
 #include <sys/types.h>
+#include <sys/un.h>
+#include <sys/utsname.h>
 #include <sys/wait.h>
 #include <syslog.h>
 #include <time.h>
@@ -62,11 +73,8 @@
 #	endif
 #endif
 
-// I18n
-#include <libintl.h>
-#include <locale.h>
-
 #include "FBInk/fbink.h"
+#include "fat/fat.h"
 #include "libue/libue.h"
 #include "openssh/atomicio.h"
 #include "openssh/bsd-closefrom.h"
@@ -84,8 +92,17 @@
 // Apparently the libevdev version string isn't available anywhere, so, fake it
 #define LIBEVDEV_VERSION "1.13.4"
 
-// Gettext
-#define _(String) gettext(String)
+// I18n: our translations are compiled in (c.f., tools/po2c.py & tr_lookup)
+typedef struct
+{
+	const char*        code;       // As found in $LANGUAGE
+	const char*        catalog;    // The po/ catalog it was built from
+	const char* const* strings;    // Indexed like tr_msgids, NULL if untranslated
+} USBMSTranslation;
+#include "l10n/translations.h"
+// The current language (NULL for English)
+const USBMSTranslation* tr_lang = NULL;
+#define _(String) tr_lookup(String)
 
 // Logging helpers
 #define LOG(prio, fmt, ...) ({ syslog(prio, fmt, ##__VA_ARGS__); })
@@ -107,6 +124,13 @@
 // We use a specific exit code for early aborts, in order to be able to know whether onboard is usable or not after a failure...
 #define USBMS_EARLY_EXIT 86
 
+// Allows pointing the sysfs & procfs paths we poll at a fake root (c.f., bench/bench.c)
+#ifndef USBMS_SYSROOT
+#	define USBMS_SYSROOT ""
+#endif
+#define SYSFS_ROOT  USBMS_SYSROOT "/sys"
+#define PROCFS_ROOT USBMS_SYSROOT "/proc"
+
 // c.f., https://github.com/koreader/koreader-base/blob/master/input/input-kobo.h
 #define KOBO_USB_DEVPATH_PLUG "/devices/platform/usb_plug"    // Plugged into a plain power source
 #define KOBO_USB_DEVPATH_HOST "/devices/platform/usb_host"    // Plugged into a computer
@@ -116,40 +140,103 @@
 #define KOBO_USB_DEVPATH_UDC  "/devices/platform/soc/5100000.udc-controller"    // OK
 #define KOBO_USB_DEVPATH_MTK  "/devices/platform/11211000.usb"                  // OK
 
+// What an uevent means to us (c.f., classify_uevent)
+typedef enum
+{
+	USB_EVENT_NONE = 0,
+	USB_EVENT_PLUG_POWER,     // Plugged into a plain power source
+	USB_EVENT_PLUG_HOST,      // Plugged into a computer
+	USB_EVENT_CHARGE_TICK,    // Something changed on a power supply
+	USB_EVENT_EJECT,
+	USB_EVENT_UNPLUG,
+} USB_EVENT_E;
+
 // It sure would be nice if the kernel was recent enough that we had the `function` devattr in there...
-#define KOBO_USB_GADGET_STATE_MTK "/sys/class/udc/11211000.usb/state"
+#define KOBO_USB_GADGET_STATE_MTK SYSFS_ROOT "/class/udc/11211000.usb/state"
 
 char* NTX_KEYS_EVDEV = NULL;
-#define NXP_BATT_CAP_SYSFS    "/sys/class/power_supply/mc13892_bat/capacity"
-#define SUNXI_BATT_CAP_SYSFS  "/sys/class/power_supply/battery/capacity"
-#define MTK_BATT_CAP_SYSFS    "/sys/class/power_supply/bd71827_bat/capacity"
-#define CILIX_CONNECTED_SYSFS "/sys/class/misc/cilix/cilix_conn"
-#define CILIX_BATT_CAP_SYSFS  "/sys/class/misc/cilix/cilix_bat_capacity"
-const char* BATT_CAP_SYSFS = NULL;
+#define NXP_BATT_CAP_SYSFS    SYSFS_ROOT "/class/power_supply/mc13892_bat/capacity"
+#define SUNXI_BATT_CAP_SYSFS  SYSFS_ROOT "/class/power_supply/battery/capacity"
+#define MTK_BATT_CAP_SYSFS    SYSFS_ROOT "/class/power_supply/bd71827_bat/capacity"
+#define CILIX_CONNECTED_SYSFS SYSFS_ROOT "/class/misc/cilix/cilix_conn"
+#define CILIX_BATT_CAP_SYSFS  SYSFS_ROOT "/class/misc/cilix/cilix_bat_capacity"
 // NOTE: On sunxi, the CM_USB_Plug_IN ioctl is currently broken (it's poking at "mc13892_bat" instead of "battery"),
 //       so, rely on sysfs ourselves instead...
-#define SUNXI_BATT_STATUS_SYSFS "/sys/class/power_supply/battery/status"
-#define MTK_BATT_STATUS_SYSFS   "/sys/class/power_supply/bd71827_bat/status"
-const char* BATT_STATUS_SYSFS      = NULL;
-bool (*fxpIsUSBPlugged)(int, bool) = NULL;
+#define SUNXI_BATT_STATUS_SYSFS SYSFS_ROOT "/class/power_supply/battery/status"
+#define MTK_BATT_STATUS_SYSFS   SYSFS_ROOT "/class/power_supply/bd71827_bat/status"
 // These, on the other hand, are only available on Mk. 7+
-#define NXP_CHARGER_TYPE_SYSFS   "/sys/class/power_supply/mc13892_charger/device/charger_type"
-#define SUNXI_CHARGER_TYPE_SYSFS "/sys/class/power_supply/charger/device/charger_type"
+#define NXP_CHARGER_TYPE_SYSFS   SYSFS_ROOT "/class/power_supply/mc13892_charger/device/charger_type"
+#define SUNXI_CHARGER_TYPE_SYSFS SYSFS_ROOT "/class/power_supply/charger/device/charger_type"
 // Finally, we're also starting to see more standard stuff... (e.g., on Mk. 10)
-#define STD_CHARGER_TYPE_SYSFS   "/sys/class/power_supply/ac/device/charger_type"
-#define MTK_CHARGER_TYPE_SYSFS   "/sys/class/power_supply/bd71827_bat/charger_type"
+#define STD_CHARGER_TYPE_SYSFS   SYSFS_ROOT "/class/power_supply/ac/device/charger_type"
+#define MTK_CHARGER_TYPE_SYSFS   SYSFS_ROOT "/class/power_supply/bd71827_bat/charger_type"
 // For ref., on mainline w/ @akemnade's driver: /sys/class/power_supply/rn5t618-usb/usb_type
-const char* CHARGER_TYPE_SYSFS = NULL;
 // For the weird standalone USB-C controller found on sunxi & Mk. 9...
 // Ironically, it doesn't appear to do much on Mk.9, at least as far as cable sense is concerned...
-#define SUNXI_USBC_PLUG_SYSFS_FMT "/sys/devices/virtual/input/input%s/USB_PLUG"
+#define SUNXI_USBC_PLUG_SYSFS_FMT SYSFS_ROOT "/devices/virtual/input/input%s/USB_PLUG"
 char* USBC_PLUG_SYSFS = NULL;
 char* USBC_EVDEV      = NULL;
+// The paths above are only figured out once, at startup, and kept around for the whole session,
+// so they live in a static bump arena instead of on the heap (c.f., arena_printf).
+#define USBMS_ARENA_SIZE 1024U
+typedef struct
+{
+	char   buf[USBMS_ARENA_SIZE];
+	size_t used;
+} USBMSArena;
+USBMSArena usbms_arena = { 0 };
 // With the BD71828 PMIC, the battery status *may* report Discharging while plugged in,
 // instead, the PMIC exports a dedicated power_supply named "usb" whose online entry we can check...
-#define ROHM_USB_ONLINE_SYSFS "/sys/class/power_supply/usb/online"
-const char* USB_ONLINE_SYSFS = NULL;
-#define FL_INTENSITY_SYSFS "/sys/class/backlight/mxc_msp430.0/actual_brightness"
+#define ROHM_USB_ONLINE_SYSFS SYSFS_ROOT "/class/power_supply/usb/online"
+#define FL_INTENSITY_SYSFS SYSFS_ROOT "/class/backlight/mxc_msp430.0/actual_brightness"
+
+// Per-SoC family backends: where to find the battery & charger bits, and how to sense the cable (c.f., usbms_backends).
+// One of them is picked once per launch (c.f., probe_sysfs & load_probe_cache), and everything else just goes through it.
+typedef enum
+{
+	BACKEND_NXP = 0,    // NTX boards up to Mk. 8
+	BACKEND_MK9,        // NXP, but with the newer power supplies (and, possibly, a BD71828 PMIC)
+	BACKEND_SUNXI,
+	BACKEND_MTK,
+	BACKEND_COUNT,    // Keep last
+} USBMS_BACKEND_E;
+
+typedef struct
+{
+	USBMS_BACKEND_E id;
+	const char*     name;            // For the logs & the probe cache
+	const char*     batt_cap;        // sysfs paths, NULL if unsupported
+	const char*     batt_status;
+	const char*     usb_online;
+	const char*     charger_type;
+	bool (*is_usb_plugged)(int ntxfd, bool log_status);
+} USBMSBackend;
+// NOTE: A copy of one of usbms_backends, as some of the NXP bits can only be figured out at runtime.
+USBMSBackend usbms_backend = { 0 };
+
+// The sysfs attributes we read on every status bar tick or uevent are kept open, and simply re-read from the start
+// (c.f., read_sysfs_attr)
+typedef enum
+{
+	ATTR_BATT_STATUS = 0,
+	ATTR_USB_ONLINE,
+	ATTR_USBC_PLUG,
+	ATTR_BATT_CAP,
+	ATTR_AUX_CONNECTED,
+	ATTR_AUX_BATT_CAP,
+	ATTR_NET_CARRIER,
+	ATTR_UDC_STATE,
+	ATTR_COUNT,    // Keep last
+} SYSFS_ATTR_E;
+
+typedef struct
+{
+	const char* path;    // NULL if unsupported on this device
+	int         fd;      // -1 until first read
+} SysfsAttr;
+SysfsAttr sysfs_attrs[ATTR_COUNT] = { [0 ... ATTR_COUNT - 1] = { NULL, -1 } };
+// Depends on the Wi-Fi interface name, which we get from KOReader
+char NET_CARRIER_SYSFS[PATH_MAX] = { 0 };
 
 // Because MXCFB_WAIT_FOR_UPDATE_COMPLETE is unreliable on a few NTX boards...
 int (*fxpWaitForUpdateComplete)(int, uint32_t) = NULL;
@@ -168,6 +255,97 @@ int (*fxpWaitForUpdateComplete)(int, uint32_t) = NULL;
 #define KOBO_TZPATH        "/etc/zoneinfo-kobo"
 #define SYSTEM_TZFILE      "/etc/localtime"
 
+// Native session handling (c.f., scripts/start-usbms.sh & scripts/end-usbms.sh)
+// Nickel's version tag, which we need to pull the serial number & FW version from
+#define KOBO_VERSION_TAG        KOBO_MOUNTPOINT "/.kobo/version"
+#define KOBO_USB_VENDOR_ID      "0x2237"
+#define KOBO_DEFAULT_SERIAL     "N000000000000"
+#define KOBO_DEFAULT_FW_VERSION "4.6.9995"
+// Kernel modules live in /drivers/${PLATFORM}
+#define KOBO_MODULES_PATH       "/drivers"
+#define KOBO_PLATFORM_MTK       "mt8113t-ntx"
+// MTK boards use a different partition layout, and configfs instead of legacy gadget modules
+#define KOBO_PARTITION_MTK      "/dev/mmcblk0p12"
+#define KOBO_UDC_MTK            "11211000.usb"
+#define USB_GADGET_CONFIGFS     "/sys/kernel/config/usb_gadget"
+// Room for KOBO_MODULES_PATH/<platform> & USB_GADGET_CONFIGFS/<gadget>,
+// small enough that anything we build on top of those provably fits in PATH_MAX
+#define USBMS_MODULES_PATH_MAX  128U
+#define USBMS_GADGET_PATH_MAX   64U
+// Modern FW ships an init script that sets up the "kobo" gadget (instead of "g1")
+#define KOBO_USB_GADGET_INIT    "/etc/init.d/usb-gadget"
+// Same as the stock script
+#define KOBO_MOUNT_FLAGS        (MS_NOATIME | MS_NODIRATIME)
+#define KOBO_MOUNT_DATA         "shortname=mixed,utf8"
+#define KOBO_MOUNT_DATA_USEFREE KOBO_MOUNT_DATA ",usefree"
+
+// Steps of the native session setup & teardown, used to report where things went wrong
+typedef enum
+{
+	USBMS_STEP_OK = 0,
+	// Nothing has been touched yet, so we can still fall back to the scripts
+	USBMS_STEP_PLATFORM,
+	USBMS_STEP_IN_SESSION,
+	// From here on out, the state of the system has been altered
+	USBMS_STEP_UMOUNT,
+	USBMS_STEP_MODULES,
+	USBMS_STEP_CONFIGFS,
+	USBMS_STEP_UDC,
+	USBMS_STEP_FSCK,
+	USBMS_STEP_MOUNT,
+} USBMS_STEP_E;
+
+// Phases of a session, for the timing trace (c.f., trace_begin & trace_end)
+typedef enum
+{
+	PHASE_FBINK_INIT = 0,
+	PHASE_FONTS,
+	PHASE_LOGO,
+	PHASE_INPUT_SCAN,
+	PHASE_BUSY_CHECK,
+	PHASE_PLUG_WAIT,
+	PHASE_LOCK,
+	PHASE_START_SESSION,
+	PHASE_HOST_SESSION,
+	PHASE_END_SESSION,
+	PHASE_FSCK,
+	PHASE_TIME_SYNC,
+	PHASE_COUNT,    // Keep last
+} USBMS_PHASE_E;
+
+typedef struct
+{
+	struct timespec start;
+	long int        elapsed_us;    // -1 if it never ran
+	int             outer;         // The phase we were in when it began (or -1), c.f., session_trace.current
+	bool            running;
+} USBMSPhase;
+
+// Machine-readable summary of where the time went, dumped on exit
+#define USBMS_TRACE_FILE "/tmp/usbms-trace.json"
+typedef struct
+{
+	struct timespec start;
+	USBMSPhase      phases[PHASE_COUNT];
+	int             last;              // Last phase entered (or -1)
+	int             current;           // Innermost phase currently running on the main thread (or -1)
+	long int        first_paint_us;    // Time to the header's first refresh (-1 if we never got there)
+	long int        locked_kb;         // VmLck of a locked session (-1 if it wasn't one)
+	bool            use_scripts;
+} USBMSTrace;
+USBMSTrace session_trace = { 0 };
+
+#ifdef USBMS_MALLOC_STATS
+// Heap accounting, per phase (c.f., make MALLOC_STATS=1, and the __wrap_ allocators in usbms.c)
+// NOTE: The extra slot is for whatever happens outside of a phase.
+typedef struct
+{
+	unsigned long int allocs;
+	unsigned long int frees;
+} USBMSAllocStats;
+USBMSAllocStats alloc_stats[PHASE_COUNT + 1U] = { 0 };
+#endif
+
 // List of exportable partitions
 typedef enum
 {
@@ -184,18 +362,299 @@ typedef struct
 	const char*    mountpoint;
 } USBMSPartition;
 
+// What the status bar displays
+typedef struct
+{
+	bool    usb_plugged;
+	bool    has_aux_battery;
+	bool    wifi_up;
+	uint8_t batt_perc;
+	uint8_t aux_batt_perc;
+	char    sz_time[6];
+} USBMSStatus;
+
+// Its fields, as flagged by diff_status
+typedef enum
+{
+	STATUS_FIELD_PLUG     = 1 << 0,
+	STATUS_FIELD_TIME     = 1 << 1,
+	STATUS_FIELD_BATT     = 1 << 2,
+	STATUS_FIELD_AUX_BATT = 1 << 3,
+	STATUS_FIELD_WIFI     = 1 << 4,
+} STATUS_FIELD_E;
+
+// Our resource bundle (c.f., tools/mkbundle.py): a header, an index, then each entry's data, page-aligned.
+// NOTE: Keep these in sync with mkbundle's own structs!
+#define USBMS_BUNDLE_FILE    "resources/usbms.bundle"
+#define USBMS_BUNDLE_MAGIC   "USBMSBDL"
+#define USBMS_BUNDLE_VERSION 1U
+typedef struct
+{
+	char     magic[8];
+	uint32_t version;
+	uint32_t count;
+} USBMSBundleHeader;
+
+typedef struct
+{
+	char     name[48];    // NUL-padded
+	uint32_t offset;      // From the start of the file
+	uint32_t size;
+	uint32_t width;    // Images only
+	uint32_t height;
+} USBMSBundleEntry;
+
 typedef struct
 {
-	FBInkConfig   fbink_cfg;
-	FBInkOTConfig ot_cfg;
-	FBInkOTConfig countdown_cfg;
-	FBInkOTConfig icon_cfg;
-	FBInkOTConfig msg_cfg;
-	FBInkState    fbink_state;
-	int           fbfd;
-	int           ntxfd;
+	unsigned char* map;    // Read-only (NULL if we don't have one)
+	size_t         size;
+} USBMSBundle;
+
+// print_logo's render, exactly as it ended up in the framebuffer, for the next launches to blit back as-is
+// (c.f., load_logo_cache). Followed by the pixel data itself.
+// NOTE: On a tmpfs, like the probe cache, so only the first launch after a boot pays for the render.
+#define USBMS_LOGO_CACHE         "/tmp/usbms-logo.cache"
+#define USBMS_LOGO_CACHE_VERSION 1U
+typedef struct
+{
+	uint32_t  version;
+	char      usbms_version[64];    // As the logo itself may change
+	// What the render depends on
+	uint32_t  screen_width;
+	uint32_t  screen_height;
+	uint32_t  bpp;
+	uint8_t   current_rota;
+	bool      is_inverted;
+	// The FBInkDump, minus its data pointer
+	FBInkRect area;
+	FBInkRect clip;
+	uint8_t   rota;
+	uint8_t   dump_bpp;
+	bool      is_full;
+	uint32_t  stride;
+	uint32_t  size;
+} USBMSLogoCache;
+
+// Locked session (c.f., USBMS_LOCKED_SESSION & lock_session): files we keep mapped for the duration of the session,
+// so that mlockall keeps their page cache resident while the host owns the device.
+// NOTE: Namely, the teardown script, and the shell that'll run it.
+#define USBMS_PINNED_FILES 2U
+typedef struct
+{
+	unsigned char* map;    // NULL if unused
+	size_t         size;
+} USBMSPinnedFile;
+
+// print_icon's renders, blitted back as-is the next time the same icon is requested
+#define ICON_CACHE_SIZE 4U
+typedef struct
+{
+	const char* string;    // NULL if unused (always a string literal otherwise)
+	bool        is_inverted;
+	FBInkDump   dump;
+} USBMSIcon;
+
+typedef struct
+{
+	FBInkConfig     fbink_cfg;
+	FBInkOTConfig   ot_cfg;
+	FBInkOTConfig   countdown_cfg;
+	FBInkOTConfig   icon_cfg;
+	FBInkOTConfig   msg_cfg;
+	FBInkState      fbink_state;
+	int             fbfd;
+	int             ntxfd;
+	USBMSStatus     status;          // What's currently on screen
+	bool            status_drawn;    // Whether status is valid
+	USBMSIcon       icons[ICON_CACHE_SIZE];
+	uint8_t         next_icon;    // Next cache slot to evict
+	USBMSBundle     bundle;
+	USBMSPinnedFile pinned[USBMS_PINNED_FILES];
 } USBMSContext;
 
+// A child process for run_child to spawn
+#define USBMS_CHILD_MAX_ARGS 7U
+typedef struct
+{
+	const char* name;                                  // For the logs
+	const char* argv[USBMS_CHILD_MAX_ARGS + 1U];       // NULL-terminated, argv[0] is looked up in PATH
+	time_t      timeout;                               // In seconds (0 for none)
+	void (*on_line)(const char* line, void* data);    // Called for each line of output (NULL to just log it)
+	// If set, the child gets a pipe on USBMS_PROGRESS_FD (also exported in its env), where it can report its progress,
+	// one "PHASE <name> <pct>%" line at a time (c.f., progress in scripts/start-usbms.sh)
+	void (*on_progress)(const char* phase, uint8_t pct, void* data);
+	void* data;
+} USBMSChild;
+#define USBMS_PROGRESS_FD        3
+#define USBMS_PROGRESS_PHASE_LEN 32U
+// How long a child gets to exit after a SIGTERM, before we SIGKILL it
+#define USBMS_CHILD_KILL_GRACE 5
+
+// What the message area currently shows about a child's progress
+typedef struct
+{
+	USBMSContext* ctx;
+	const char*   msg;    // What we print above the progress
+	char          phase[USBMS_PROGRESS_PHASE_LEN];
+	uint8_t       pct;
+} USBMSProgress;
+
+// What the startup helper thread gets to work with, and what it finds out (c.f., probe_device)
+typedef struct
+{
+	const char*       abs_pwd;
+	const FBInkState* fbink_state;
+	int               ntxfd;
+	char              ntx_keys_name[256];    // The power button's input device name
+	long int          input_scan_us;         // How long scan_input_devices took (-1 if it didn't run)
+	bool              with_pipefail;
+} USBMSProbe;
+// probe_device's thread stack size: its deepest path (load_probe_cache, then libc) is about 30 kB (c.f., -fstack-usage)
+#define USBMS_PROBE_STACK_SIZE (64U * 1024U)
+
+// What probe_device found out last time (c.f., load_probe_cache)
+// NOTE: On a tmpfs, so it won't survive a reboot, which saves us from having to care about hotplugging too much
+#define USBMS_PROBE_CACHE         "/tmp/usbms-probe.cache"
+#define USBMS_PROBE_CACHE_VERSION 2
+
+// Warm standby mode (c.f., run_standby), enabled by setting USBMS_STANDBY in the env
+#define USBMS_STANDBY_SOCKET       "/tmp/usbms.sock"
+#define USBMS_STANDBY_CMD_START    'S'
+#define USBMS_STANDBY_CMD_QUIT     'Q'
+// run_standby's return value in a session's child
+#define USBMS_STANDBY_SESSION      -1
+// Release our preloaded resources if MemAvailable dips below this (in kB)
+#define USBMS_STANDBY_MIN_AVAIL_KB (24L * 1024L)
+#define USBMS_STANDBY_MEMCHECK_MS  (30 * 1000)
+
+// Our event loop (c.f., reactor_run): every fd we wait on goes through a single epoll set,
+// and every timer we need (status bar, countdown, debounce, child timeouts) is multiplexed onto one timerfd per clock:
+// the status bar's clock runs off CLOCK_REALTIME, everything else is relative, and runs off CLOCK_MONOTONIC.
+// NOTE: There are never more than a handful of timers armed at once, so they live in a tiny fixed table,
+//       and each timerfd is simply armed for its earliest deadline. Nothing in there ever touches the heap.
+#define REACTOR_CONTINUE    0    // Callbacks return anything else to stop reactor_run, which then returns it
+#define REACTOR_MAX_SOURCES 8U
+#define REACTOR_MAX_TIMERS  4U
+#define REACTOR_MAX_EVENTS  8
+typedef struct USBMSReactor USBMSReactor;
+typedef int (*USBMSReactorFdCb)(USBMSReactor* reactor, int fd, uint32_t events, void* data);
+typedef int (*USBMSReactorTimerCb)(USBMSReactor* reactor, void* data);
+typedef struct
+{
+	int              fd;    // -1 if unused
+	USBMSReactorFdCb cb;
+	void*            data;
+} USBMSReactorSource;
+typedef struct
+{
+	clockid_t           clock;
+	struct timespec     deadline;       // Absolute, on clock
+	long int            interval_ms;    // 0 for a one-shot timer
+	USBMSReactorTimerCb cb;             // NULL if unused
+	void*               data;
+} USBMSReactorTimer;
+typedef enum
+{
+	REACTOR_CLOCK_MONOTONIC = 0,
+	REACTOR_CLOCK_REALTIME,
+	REACTOR_CLOCKS,
+} REACTOR_CLOCK_E;
+typedef struct
+{
+	clockid_t       id;
+	int             tfd;
+	struct timespec armed;    // What tfd is currently armed for (0 if disarmed)
+} USBMSReactorClock;
+struct USBMSReactor
+{
+	int                epfd;
+	USBMSReactorClock  clocks[REACTOR_CLOCKS];
+	USBMSReactorSource sources[REACTOR_MAX_SOURCES];
+	USBMSReactorTimer  timers[REACTOR_MAX_TIMERS];
+};
+// A reactor that reactor_close can safely be called on before (or without) reactor_init
+#define REACTOR_INITIALIZER { .epfd = -1, .clocks = { { .tfd = -1 }, { .tfd = -1 } } }
+
+// What ends a reactor_run (c.f., USBMSWait, USBMSChildRun, USBMSFlush & USBMSStandby)
+typedef enum
+{
+	WAIT_CONTINUE = REACTOR_CONTINUE,
+	WAIT_POWER_BUTTON,    // Power button release
+	WAIT_COUNTDOWN,       // The countdown ran out
+	WAIT_UEVENT,          // One of the uevents we were waiting for (c.f., USBMSWait.event)
+	WAIT_TIMER,           // A plain timeout (c.f., reactor_sleep)
+	WAIT_CHILD,           // The child exited (c.f., run_child & flush_exported_fs)
+	WAIT_FAILED,          // Failed to read from the uevent socket
+	WAIT_QUIT,            // We were asked to leave standby (c.f., run_standby)
+	WAIT_SESSION,         // We're the freshly forked child of a standby session request (c.f., run_standby)
+} USBMS_WAIT_E;
+
+// Everything one of main's waits listens to (unused fds are set to -1), and what ended it
+typedef struct
+{
+	USBMSContext*           ctx;
+	struct libevdev*        dev;         // Power button
+	struct libevdev*        usbc_dev;    // Standalone USB-C controller
+	struct uevent_listener* listener;
+	int                     evfd;
+	int                     uefd;
+	int                     usbc_fd;
+	int                     udc_fd;       // UDC state (c.f., ATTR_UDC_STATE)
+	unsigned int            uevents;      // The USB_EVENT_E that end the wait, as a (1U << event) mask
+	time_t                  countdown;    // In seconds, 0 for none
+	time_t                  elapsed;
+	int                     timer;
+	USB_EVENT_E             event;
+	int                     usb_c_plugged;
+	struct uevent           uev;
+} USBMSWait;
+
+// What run_child keeps track of while the child runs
+typedef struct
+{
+	const USBMSChild* child;
+	pid_t             pid;
+	int               status;
+	int               outfd;     // -1 once we've hit EOF
+	int               progfd;    // Ditto
+	int               timer;
+	bool              killed;
+	char              buf[PIPE_BUF];
+	size_t            len;
+	char              pbuf[PIPE_BUF];
+	size_t            plen;
+} USBMSChildRun;
+
+// What flush_exported_fs keeps track of while the syncfs child runs
+typedef struct
+{
+	USBMSContext*     ctx;
+	pid_t             pid;
+	int               status;
+	unsigned long int initial;    // In kB
+	int               shown;      // The last percentage we printed
+} USBMSFlush;
+
+// What run_standby keeps track of while it's on standby
+typedef struct
+{
+	USBMSContext* ctx;
+	const char*   abs_pwd;
+	bool          is_CJK;
+	int           sfd;         // Our listening socket
+	int           memcheck;    // The memory pressure timer (-1 once we've released our preloaded resources)
+	pid_t         pid;         // The live session's child (-1 if there isn't one)
+	int           cfd;         // Its client, which is waiting for its exit code
+} USBMSStandby;
+
+// What run_child keeps alive while it waits on a child (i.e., the status bar, via the main reactor)
+typedef struct
+{
+	USBMSContext* ctx;
+	USBMSReactor* reactor;
+} USBMSSpawnUI;
+USBMSSpawnUI spawn_ui = { NULL, NULL };
+
 // c.f., arch/arm/mach-imx/imx_ntx_io.c or arch/arm/mach-sunxi/sunxi_ntx_io.c in a Kobo kernel
 #define CM_USB_Plug_IN        108
 #define CM_CHARGE_STATUS      204    // Mapped to CM_USB_Plug_IN on Mk. 7+...